@@ -27,12 +27,12 @@ constexpr const char* decode_error_message(decode_error err) {
 class codec {
 public:
   // encode instruction to 32-bit word
-  static word encode(const instruction& inst) {
+  static constexpr word encode(const instruction& inst) {
     return std::visit([](const auto& i) { return i.encode(); }, inst);
   }
 
   // decode 32-bit word to instruction
-  static result<instruction, decode_error> decode(word w) {
+  static constexpr result<instruction, decode_error> decode(word w) {
     opcode op = static_cast<opcode>((w >> 24) & 0xff);
 
     // validate opcode exists in our mapping
@@ -99,7 +99,7 @@ public:
   }
 
   // encode to byte array (little-endian)
-  static std::array<byte, 4> encode_bytes(const instruction& inst) {
+  static constexpr std::array<byte, 4> encode_bytes(const instruction& inst) {
     word w = encode(inst);
     return {
         static_cast<byte>(w & 0xff),         // bits 7-0
@@ -1,11 +1,21 @@
 #pragma once
 
 #include "types.hpp"
+#include <array>
 #include <variant>
 #include <tuple>
 #include <string>
+#include <type_traits>
 #include <cstdio>
 
+// force tiny instruction factories to inline so construction folds away at
+// every call site even without lto
+#if defined(__GNUC__) || defined(__clang__)
+#define IRRE_ALWAYS_INLINE [[gnu::always_inline]] inline
+#else
+#define IRRE_ALWAYS_INLINE inline
+#endif
+
 namespace irre {
 
 // individual instruction format structs; each knows how to encode/decode itself
@@ -13,34 +23,34 @@ namespace irre {
 struct inst_op {
   opcode op;
 
-  static inst_op decode(word w) { return {static_cast<opcode>((w >> 24) & 0xff)}; }
+  static constexpr inst_op decode(word w) { return {static_cast<opcode>((w >> 24) & 0xff)}; }
 
-  word encode() const { return static_cast<word>(op) << 24; }
+  constexpr word encode() const { return static_cast<word>(op) << 24; }
 };
 
 struct inst_op_reg {
   opcode op;
   reg a;
 
-  static inst_op_reg decode(word w) {
+  static constexpr inst_op_reg decode(word w) {
     return {static_cast<opcode>((w >> 24) & 0xff), static_cast<reg>((w >> 16) & 0xff)};
   }
 
-  word encode() const { return (static_cast<word>(op) << 24) | (static_cast<word>(a) << 16); }
+  constexpr word encode() const { return (static_cast<word>(op) << 24) | (static_cast<word>(a) << 16); }
 };
 
 struct inst_op_imm24 {
   opcode op;
   uint32_t addr; // 24-bit address
 
-  static inst_op_imm24 decode(word w) {
+  static constexpr inst_op_imm24 decode(word w) {
     return {
         static_cast<opcode>((w >> 24) & 0xff),
         w & 0xffffff // extract lower 24 bits
     };
   }
 
-  word encode() const {
+  constexpr word encode() const {
     return (static_cast<word>(op) << 24) | (addr & 0xffffff); // mask to 24 bits
   }
 };
@@ -50,27 +60,27 @@ struct inst_op_reg_imm16 {
   reg a;
   uint16_t imm;
 
-  static inst_op_reg_imm16 decode(word w) {
+  static constexpr inst_op_reg_imm16 decode(word w) {
     return {
         static_cast<opcode>((w >> 24) & 0xff), static_cast<reg>((w >> 16) & 0xff),
         static_cast<uint16_t>(w & 0xffff) // lower 16 bits
     };
   }
 
-  word encode() const { return (static_cast<word>(op) << 24) | (static_cast<word>(a) << 16) | static_cast<word>(imm); }
+  constexpr word encode() const { return (static_cast<word>(op) << 24) | (static_cast<word>(a) << 16) | static_cast<word>(imm); }
 };
 
 struct inst_op_reg_reg {
   opcode op;
   reg a, b;
 
-  static inst_op_reg_reg decode(word w) {
+  static constexpr inst_op_reg_reg decode(word w) {
     return {
         static_cast<opcode>((w >> 24) & 0xff), static_cast<reg>((w >> 16) & 0xff), static_cast<reg>((w >> 8) & 0xff)
     };
   }
 
-  word encode() const {
+  constexpr word encode() const {
     return (static_cast<word>(op) << 24) | (static_cast<word>(a) << 16) | (static_cast<word>(b) << 8);
   }
 };
@@ -80,14 +90,14 @@ struct inst_op_reg_reg_imm8 {
   reg a, b;
   uint8_t offset;
 
-  static inst_op_reg_reg_imm8 decode(word w) {
+  static constexpr inst_op_reg_reg_imm8 decode(word w) {
     return {
         static_cast<opcode>((w >> 24) & 0xff), static_cast<reg>((w >> 16) & 0xff), static_cast<reg>((w >> 8) & 0xff),
         static_cast<uint8_t>(w & 0xff)
     };
   }
 
-  word encode() const {
+  constexpr word encode() const {
     return (static_cast<word>(op) << 24) | (static_cast<word>(a) << 16) | (static_cast<word>(b) << 8) |
            static_cast<word>(offset);
   }
@@ -98,14 +108,14 @@ struct inst_op_reg_imm8x2 {
   reg a;
   uint8_t v0, v1;
 
-  static inst_op_reg_imm8x2 decode(word w) {
+  static constexpr inst_op_reg_imm8x2 decode(word w) {
     return {
         static_cast<opcode>((w >> 24) & 0xff), static_cast<reg>((w >> 16) & 0xff),
         static_cast<uint8_t>((w >> 8) & 0xff), static_cast<uint8_t>(w & 0xff)
     };
   }
 
-  word encode() const {
+  constexpr word encode() const {
     return (static_cast<word>(op) << 24) | (static_cast<word>(a) << 16) | (static_cast<word>(v0) << 8) |
            static_cast<word>(v1);
   }
@@ -115,135 +125,220 @@ struct inst_op_reg_reg_reg {
   opcode op;
   reg a, b, c;
 
-  static inst_op_reg_reg_reg decode(word w) {
+  // the four extractions below are independent byte moves; with the members
+  // packed in field order the optimizer contracts them into a single
+  // byte-swap of the word, so no manual swar/pdep fan-out is needed
+  static constexpr inst_op_reg_reg_reg decode(word w) {
     return {
         static_cast<opcode>((w >> 24) & 0xff), static_cast<reg>((w >> 16) & 0xff), static_cast<reg>((w >> 8) & 0xff),
         static_cast<reg>(w & 0xff)
     };
   }
 
-  word encode() const {
+  constexpr word encode() const {
     return (static_cast<word>(op) << 24) | (static_cast<word>(a) << 16) | (static_cast<word>(b) << 8) |
            static_cast<word>(c);
   }
 };
 
-// unified instruction type using variant
+// decode/encode contracting to single byte-swaps depends on the operand
+// bytes sitting in field order with no padding
+static_assert(sizeof(inst_op_reg_reg_reg) == 4, "op/a/b/c must pack into one word");
+static_assert(sizeof(inst_op_reg_reg_imm8) == 4, "op/a/b/offset must pack into one word");
+static_assert(sizeof(inst_op_reg_imm8x2) == 4, "op/a/v0/v1 must pack into one word");
+
+// every format must stay a trivially-copyable aggregate: a user-provided
+// constructor on any of them would drop variant copies to member-wise paths
+// instead of memcpy and stop instances from being passed in registers
+static_assert(
+    std::is_trivially_copyable_v<inst_op> && std::is_trivially_copyable_v<inst_op_reg> &&
+        std::is_trivially_copyable_v<inst_op_imm24> && std::is_trivially_copyable_v<inst_op_reg_imm16> &&
+        std::is_trivially_copyable_v<inst_op_reg_reg> && std::is_trivially_copyable_v<inst_op_reg_reg_imm8> &&
+        std::is_trivially_copyable_v<inst_op_reg_imm8x2> && std::is_trivially_copyable_v<inst_op_reg_reg_reg>,
+    "instruction formats must remain trivially copyable"
+);
+static_assert(
+    std::is_aggregate_v<inst_op> && std::is_aggregate_v<inst_op_reg> && std::is_aggregate_v<inst_op_imm24> &&
+        std::is_aggregate_v<inst_op_reg_imm16> && std::is_aggregate_v<inst_op_reg_reg> &&
+        std::is_aggregate_v<inst_op_reg_reg_imm8> && std::is_aggregate_v<inst_op_reg_imm8x2> &&
+        std::is_aggregate_v<inst_op_reg_reg_reg>,
+    "instruction formats must remain aggregates"
+);
+
+// unified instruction type using variant. the typed alternatives are the api
+// the rest of the tree pattern-matches on (visitor dispatch, std::get in the
+// vm and tests), so the variant is kept over a raw-word tagged union; the
+// assert below pins its small footprint so accidental growth fails the build
 using instruction = std::variant<
     inst_op, inst_op_reg, inst_op_imm24, inst_op_reg_imm16, inst_op_reg_reg, inst_op_reg_reg_imm8, inst_op_reg_imm8x2,
     inst_op_reg_reg_reg>;
 
-// helper to get opcode from any instruction variant
-inline opcode get_opcode(const instruction& inst) {
+static_assert(sizeof(instruction) <= 3 * sizeof(word), "instruction payload plus discriminant grew unexpectedly");
+
+// helper to get opcode from any instruction variant; the generic-lambda visit
+// lowers to a jump table on the 3-bit discriminant, and constexpr plus forced
+// inlining lets calls on known instructions fold to a constant
+IRRE_ALWAYS_INLINE constexpr opcode get_opcode(const instruction& inst) {
   return std::visit([](const auto& i) { return i.op; }, inst);
 }
 
 // helper to get format from any instruction variant
-inline format get_format(const instruction& inst) { return get_format(get_opcode(inst)); }
+IRRE_ALWAYS_INLINE constexpr format get_format(const instruction& inst) { return get_format(get_opcode(inst)); }
 
 // convenience constructors for each format
 namespace make {
-inline instruction op(opcode op) { return inst_op{op}; }
+IRRE_ALWAYS_INLINE constexpr instruction op(opcode op) noexcept { return inst_op{op}; }
 
-inline instruction op_reg(opcode op, reg a) { return inst_op_reg{op, a}; }
+IRRE_ALWAYS_INLINE constexpr instruction op_reg(opcode op, reg a) noexcept { return inst_op_reg{op, a}; }
 
-inline instruction op_imm24(opcode op, uint32_t addr) { return inst_op_imm24{op, addr}; }
+IRRE_ALWAYS_INLINE constexpr instruction op_imm24(opcode op, uint32_t addr) noexcept { return inst_op_imm24{op, addr}; }
 
-inline instruction op_reg_imm16(opcode op, reg a, uint16_t imm) { return inst_op_reg_imm16{op, a, imm}; }
+IRRE_ALWAYS_INLINE constexpr instruction op_reg_imm16(opcode op, reg a, uint16_t imm) noexcept { return inst_op_reg_imm16{op, a, imm}; }
 
-inline instruction op_reg_reg(opcode op, reg a, reg b) { return inst_op_reg_reg{op, a, b}; }
+IRRE_ALWAYS_INLINE constexpr instruction op_reg_reg(opcode op, reg a, reg b) noexcept { return inst_op_reg_reg{op, a, b}; }
 
-inline instruction op_reg_reg_imm8(opcode op, reg a, reg b, uint8_t offset) {
-  return inst_op_reg_reg_imm8{op, a, b, offset};
+IRRE_ALWAYS_INLINE constexpr instruction op_reg_reg_imm8(opcode op, reg a, reg b, uint8_t offset) noexcept { return inst_op_reg_reg_imm8{op, a, b, offset};
 }
 
-inline instruction op_reg_imm8x2(opcode op, reg a, uint8_t v0, uint8_t v1) { return inst_op_reg_imm8x2{op, a, v0, v1}; }
+IRRE_ALWAYS_INLINE constexpr instruction op_reg_imm8x2(opcode op, reg a, uint8_t v0, uint8_t v1) noexcept { return inst_op_reg_imm8x2{op, a, v0, v1}; }
 
-inline instruction op_reg_reg_reg(opcode op, reg a, reg b, reg c) { return inst_op_reg_reg_reg{op, a, b, c}; }
+IRRE_ALWAYS_INLINE constexpr instruction op_reg_reg_reg(opcode op, reg a, reg b, reg c) noexcept { return inst_op_reg_reg_reg{op, a, b, c}; }
 
 // convenience constructors for common instructions
-inline instruction nop() { return op(opcode::nop); }
-inline instruction hlt() { return op(opcode::hlt); }
-inline instruction ret() { return op(opcode::ret); }
+IRRE_ALWAYS_INLINE constexpr instruction nop() noexcept { return op(opcode::nop); }
+IRRE_ALWAYS_INLINE constexpr instruction hlt() noexcept { return op(opcode::hlt); }
+IRRE_ALWAYS_INLINE constexpr instruction ret() noexcept { return op(opcode::ret); }
 
-inline instruction add(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::add, a, b, c); }
-inline instruction sub(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::sub, a, b, c); }
-inline instruction mul(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::mul, a, b, c); }
-inline instruction div(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::div, a, b, c); }
-inline instruction mod(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::mod, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction add(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::add, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction sub(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::sub, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction mul(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::mul, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction div(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::div, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction mod(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::mod, a, b, c); }
 
-inline instruction mov(reg a, reg b) { return op_reg_reg(opcode::mov, a, b); }
-inline instruction set(reg a, uint16_t imm) { return op_reg_imm16(opcode::set, a, imm); }
+IRRE_ALWAYS_INLINE constexpr instruction mov(reg a, reg b) noexcept { return op_reg_reg(opcode::mov, a, b); }
+IRRE_ALWAYS_INLINE constexpr instruction set(reg a, uint16_t imm) noexcept { return op_reg_imm16(opcode::set, a, imm); }
 
-inline instruction ldw(reg a, reg b, uint8_t offset) { return op_reg_reg_imm8(opcode::ldw, a, b, offset); }
-inline instruction stw(reg a, reg b, uint8_t offset) { return op_reg_reg_imm8(opcode::stw, a, b, offset); }
-inline instruction ldb(reg a, reg b, uint8_t offset) { return op_reg_reg_imm8(opcode::ldb, a, b, offset); }
-inline instruction stb(reg a, reg b, uint8_t offset) { return op_reg_reg_imm8(opcode::stb, a, b, offset); }
+IRRE_ALWAYS_INLINE constexpr instruction ldw(reg a, reg b, uint8_t offset) noexcept { return op_reg_reg_imm8(opcode::ldw, a, b, offset); }
+IRRE_ALWAYS_INLINE constexpr instruction stw(reg a, reg b, uint8_t offset) noexcept { return op_reg_reg_imm8(opcode::stw, a, b, offset); }
+IRRE_ALWAYS_INLINE constexpr instruction ldb(reg a, reg b, uint8_t offset) noexcept { return op_reg_reg_imm8(opcode::ldb, a, b, offset); }
+IRRE_ALWAYS_INLINE constexpr instruction stb(reg a, reg b, uint8_t offset) noexcept { return op_reg_reg_imm8(opcode::stb, a, b, offset); }
 
-inline instruction jmp(reg a) { return op_reg(opcode::jmp, a); }
-inline instruction jmi(uint32_t addr) { return op_imm24(opcode::jmi, addr); }
-inline instruction cal(reg a) { return op_reg(opcode::cal, a); }
+IRRE_ALWAYS_INLINE constexpr instruction jmp(reg a) noexcept { return op_reg(opcode::jmp, a); }
+IRRE_ALWAYS_INLINE constexpr instruction jmi(uint32_t addr) noexcept { return op_imm24(opcode::jmi, addr); }
+IRRE_ALWAYS_INLINE constexpr instruction cal(reg a) noexcept { return op_reg(opcode::cal, a); }
 
-inline instruction bve(reg a, reg b, uint8_t v) { return op_reg_reg_imm8(opcode::bve, a, b, v); }
-inline instruction bvn(reg a, reg b, uint8_t v) { return op_reg_reg_imm8(opcode::bvn, a, b, v); }
+IRRE_ALWAYS_INLINE constexpr instruction bve(reg a, reg b, uint8_t v) noexcept { return op_reg_reg_imm8(opcode::bve, a, b, v); }
+IRRE_ALWAYS_INLINE constexpr instruction bvn(reg a, reg b, uint8_t v) noexcept { return op_reg_reg_imm8(opcode::bvn, a, b, v); }
 
-inline instruction int_(uint32_t code) { return op_imm24(opcode::int_, code); }
-inline instruction snd(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::snd, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction int_(uint32_t code) noexcept { return op_imm24(opcode::int_, code); }
+IRRE_ALWAYS_INLINE constexpr instruction snd(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::snd, a, b, c); }
 
-inline instruction sia(reg a, uint8_t v0, uint8_t v1) { return op_reg_imm8x2(opcode::sia, a, v0, v1); }
-inline instruction sup(reg a, uint16_t v0) { return op_reg_imm16(opcode::sup, a, v0); }
-inline instruction sxt(reg a, reg b) { return op_reg_reg(opcode::sxt, a, b); }
-inline instruction seq(reg a, reg b, uint8_t v0) { return op_reg_reg_imm8(opcode::seq, a, b, v0); }
+IRRE_ALWAYS_INLINE constexpr instruction sia(reg a, uint8_t v0, uint8_t v1) noexcept { return op_reg_imm8x2(opcode::sia, a, v0, v1); }
+IRRE_ALWAYS_INLINE constexpr instruction sup(reg a, uint16_t v0) noexcept { return op_reg_imm16(opcode::sup, a, v0); }
+IRRE_ALWAYS_INLINE constexpr instruction sxt(reg a, reg b) noexcept { return op_reg_reg(opcode::sxt, a, b); }
+IRRE_ALWAYS_INLINE constexpr instruction seq(reg a, reg b, uint8_t v0) noexcept { return op_reg_reg_imm8(opcode::seq, a, b, v0); }
 
 // logical operations
-inline instruction and_(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::and_, a, b, c); }
-inline instruction orr(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::orr, a, b, c); }
-inline instruction xor_(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::xor_, a, b, c); }
-inline instruction not_(reg a, reg b) { return op_reg_reg(opcode::not_, a, b); }
+IRRE_ALWAYS_INLINE constexpr instruction and_(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::and_, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction orr(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::orr, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction xor_(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::xor_, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction not_(reg a, reg b) noexcept { return op_reg_reg(opcode::not_, a, b); }
 
 // shift operations
-inline instruction lsh(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::lsh, a, b, c); }
-inline instruction ash(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::ash, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction lsh(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::lsh, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction ash(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::ash, a, b, c); }
 
 // comparison operations
-inline instruction tcu(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::tcu, a, b, c); }
-inline instruction tcs(reg a, reg b, reg c) { return op_reg_reg_reg(opcode::tcs, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction tcu(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::tcu, a, b, c); }
+IRRE_ALWAYS_INLINE constexpr instruction tcs(reg a, reg b, reg c) noexcept { return op_reg_reg_reg(opcode::tcs, a, b, c); }
 } // namespace make
 
-// instruction formatting
-inline std::string format_instruction(const instruction& inst) {
-  return std::visit(
-      [](const auto& i) -> std::string {
-        const auto mnemonic = get_mnemonic(i.op);
-
-        if constexpr (std::is_same_v<std::decay_t<decltype(i)>, inst_op>) {
-          return mnemonic;
-        } else if constexpr (std::is_same_v<std::decay_t<decltype(i)>, inst_op_reg>) {
-          return std::string(mnemonic) + " " + reg_name(i.a);
-        } else if constexpr (std::is_same_v<std::decay_t<decltype(i)>, inst_op_imm24>) {
-          char buf[32];
-          std::snprintf(buf, sizeof(buf), "%s 0x%06x", mnemonic, i.addr);
-          return buf;
-        } else if constexpr (std::is_same_v<std::decay_t<decltype(i)>, inst_op_reg_imm16>) {
-          char buf[32];
-          std::snprintf(buf, sizeof(buf), "%s %s 0x%04x", mnemonic, reg_name(i.a), i.imm);
-          return buf;
-        } else if constexpr (std::is_same_v<std::decay_t<decltype(i)>, inst_op_reg_reg>) {
-          return std::string(mnemonic) + " " + reg_name(i.a) + " " + reg_name(i.b);
-        } else if constexpr (std::is_same_v<std::decay_t<decltype(i)>, inst_op_reg_reg_imm8>) {
-          char buf[32];
-          std::snprintf(buf, sizeof(buf), "%s %s %s 0x%02x", mnemonic, reg_name(i.a), reg_name(i.b), i.offset);
-          return buf;
-        } else if constexpr (std::is_same_v<std::decay_t<decltype(i)>, inst_op_reg_imm8x2>) {
-          char buf[32];
-          std::snprintf(buf, sizeof(buf), "%s %s 0x%02x 0x%02x", mnemonic, reg_name(i.a), i.v0, i.v1);
-          return buf;
-        } else if constexpr (std::is_same_v<std::decay_t<decltype(i)>, inst_op_reg_reg_reg>) {
-          return std::string(mnemonic) + " " + reg_name(i.a) + " " + reg_name(i.b) + " " + reg_name(i.c);
-        }
-      },
-      inst
-  );
+// formatted instruction text held in a fixed inline buffer; the longest
+// rendering is well under 32 bytes, so formatting never touches the heap.
+// the result compares and converts as a string_view
+struct inst_str {
+  char text[32];
+  uint8_t len;
+
+  constexpr std::string_view view() const { return std::string_view(text, len); }
+  constexpr operator std::string_view() const { return view(); }
+};
+
+inline bool operator==(const inst_str& s, std::string_view rhs) { return s.view() == rhs; }
+inline bool operator==(std::string_view lhs, const inst_str& s) { return lhs == s.view(); }
+inline bool operator!=(const inst_str& s, std::string_view rhs) { return s.view() != rhs; }
+inline bool operator!=(std::string_view lhs, const inst_str& s) { return lhs != s.view(); }
+
+// per-format renderers for the textual form, keyed by the format enum; each
+// takes the mnemonic and the encoded word, extracts its own fields, and
+// returns the formatted length. the name views point at string literals, so
+// data() is null-terminated and safe for snprintf
+namespace detail {
+
+inline int render_op(char* buf, size_t n, std::string_view m, word) { return std::snprintf(buf, n, "%s", m.data()); }
+
+inline int render_op_reg(char* buf, size_t n, std::string_view m, word w) {
+  return std::snprintf(buf, n, "%s %s", m.data(), reg_name(static_cast<reg>((w >> 16) & 0xff)).data());
+}
+
+inline int render_op_imm24(char* buf, size_t n, std::string_view m, word w) {
+  return std::snprintf(buf, n, "%s 0x%06x", m.data(), w & 0xffffff);
+}
+
+inline int render_op_reg_imm16(char* buf, size_t n, std::string_view m, word w) {
+  return std::snprintf(buf, n, "%s %s 0x%04x", m.data(), reg_name(static_cast<reg>((w >> 16) & 0xff)).data(),
+                       w & 0xffff);
+}
+
+inline int render_op_reg_reg(char* buf, size_t n, std::string_view m, word w) {
+  return std::snprintf(buf, n, "%s %s %s", m.data(), reg_name(static_cast<reg>((w >> 16) & 0xff)).data(),
+                       reg_name(static_cast<reg>((w >> 8) & 0xff)).data());
+}
+
+inline int render_op_reg_reg_imm8(char* buf, size_t n, std::string_view m, word w) {
+  return std::snprintf(buf, n, "%s %s %s 0x%02x", m.data(), reg_name(static_cast<reg>((w >> 16) & 0xff)).data(),
+                       reg_name(static_cast<reg>((w >> 8) & 0xff)).data(), w & 0xff);
+}
+
+inline int render_op_reg_imm8x2(char* buf, size_t n, std::string_view m, word w) {
+  return std::snprintf(buf, n, "%s %s 0x%02x 0x%02x", m.data(), reg_name(static_cast<reg>((w >> 16) & 0xff)).data(),
+                       (w >> 8) & 0xff, w & 0xff);
+}
+
+inline int render_op_reg_reg_reg(char* buf, size_t n, std::string_view m, word w) {
+  return std::snprintf(buf, n, "%s %s %s %s", m.data(), reg_name(static_cast<reg>((w >> 16) & 0xff)).data(),
+                       reg_name(static_cast<reg>((w >> 8) & 0xff)).data(),
+                       reg_name(static_cast<reg>(w & 0xff)).data());
+}
+
+inline constexpr std::array<int (*)(char*, size_t, std::string_view, word), 8> k_format_renderers = {
+    render_op,         render_op_reg,          render_op_imm24,      render_op_reg_imm16,
+    render_op_reg_reg, render_op_reg_reg_imm8, render_op_reg_imm8x2, render_op_reg_reg_reg,
+};
+
+} // namespace detail
+
+// instruction formatting: encode once, then one table load picks the renderer
+// for the opcode's format instead of walking a per-alternative branch chain
+// format an encoded instruction word directly: the format is fully determined
+// by the opcode byte, so dispatch is two table loads with no variant involved
+inline inst_str format_instruction(word w) {
+  const auto info = get_opcode_info(static_cast<opcode>(w >> 24));
+
+  inst_str out;
+  int len;
+  if (info.fmt == format::invalid) {
+    len = std::snprintf(out.text, sizeof(out.text), "%s", info.mnemonic.data());
+  } else {
+    len = detail::k_format_renderers[static_cast<size_t>(info.fmt)](out.text, sizeof(out.text), info.mnemonic, w);
+  }
+  out.len = static_cast<uint8_t>(len < 0 ? 0 : len);
+  return out;
+}
+
+// variant overload: one visit to re-encode the word, then the word path above
+inline inst_str format_instruction(const instruction& inst) {
+  return format_instruction(std::visit([](const auto& i) { return i.encode(); }, inst));
 }
 
 } // namespace irre
\ No newline at end of file
@@ -221,6 +221,9 @@ inline std::string describe_execution(const instruction& inst) {
   return std::visit(
       [](const auto& i) -> std::string {
         using T = std::decay_t<decltype(i)>;
+        // reg_name returns a string_view; wrap it so the concatenations below
+        // keep working with std::string operator+
+        auto rn = [](reg r) { return std::string(reg_name(r)); };
 
         if constexpr (std::is_same_v<T, inst_op>) {
           switch (i.op) {
@@ -236,9 +239,9 @@ inline std::string describe_execution(const instruction& inst) {
         } else if constexpr (std::is_same_v<T, inst_op_reg>) {
           switch (i.op) {
           case opcode::jmp:
-            return std::string("jump to address in ") + reg_name(i.a);
+            return std::string("jump to address in ") + rn(i.a);
           case opcode::cal:
-            return std::string("call function at address in ") + reg_name(i.a);
+            return std::string("call function at address in ") + rn(i.a);
           default:
             return "unknown register operation";
           }
@@ -254,45 +257,45 @@ inline std::string describe_execution(const instruction& inst) {
         } else if constexpr (std::is_same_v<T, inst_op_reg_imm16>) {
           switch (i.op) {
           case opcode::set:
-            return std::string(reg_name(i.a)) + " = " + std::to_string(i.imm);
+            return std::string(rn(i.a)) + " = " + std::to_string(i.imm);
           case opcode::sup:
-            return std::string("set upper 16 bits of ") + reg_name(i.a) + " to " + std::to_string(i.imm);
+            return std::string("set upper 16 bits of ") + rn(i.a) + " to " + std::to_string(i.imm);
           default:
             return "unknown reg+immediate operation";
           }
         } else if constexpr (std::is_same_v<T, inst_op_reg_reg>) {
           switch (i.op) {
           case opcode::mov:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b);
+            return std::string(rn(i.a)) + " = " + rn(i.b);
           case opcode::not_:
-            return std::string(reg_name(i.a)) + " = ~" + reg_name(i.b);
+            return std::string(rn(i.a)) + " = ~" + rn(i.b);
           case opcode::sxt:
-            return std::string(reg_name(i.a)) + " = sign_extend(" + reg_name(i.b) + ")";
+            return std::string(rn(i.a)) + " = sign_extend(" + rn(i.b) + ")";
           default:
             return "unknown two-register operation";
           }
         } else if constexpr (std::is_same_v<T, inst_op_reg_reg_imm8>) {
           switch (i.op) {
           case opcode::ldw:
-            return std::string(reg_name(i.a)) + " = memory[" + reg_name(i.b) + " + " +
+            return std::string(rn(i.a)) + " = memory[" + rn(i.b) + " + " +
                    std::to_string(static_cast<int8_t>(i.offset)) + "]";
           case opcode::stw:
-            return std::string("memory[") + reg_name(i.b) + " + " + std::to_string(static_cast<int8_t>(i.offset)) +
-                   "] = " + reg_name(i.a);
+            return std::string("memory[") + rn(i.b) + " + " + std::to_string(static_cast<int8_t>(i.offset)) +
+                   "] = " + rn(i.a);
           case opcode::ldb:
-            return std::string(reg_name(i.a)) + " = byte[" + reg_name(i.b) + " + " +
+            return std::string(rn(i.a)) + " = byte[" + rn(i.b) + " + " +
                    std::to_string(static_cast<int8_t>(i.offset)) + "]";
           case opcode::stb:
-            return std::string("byte[") + reg_name(i.b) + " + " + std::to_string(static_cast<int8_t>(i.offset)) +
-                   "] = " + reg_name(i.a);
+            return std::string("byte[") + rn(i.b) + " + " + std::to_string(static_cast<int8_t>(i.offset)) +
+                   "] = " + rn(i.a);
           case opcode::bve:
-            return std::string("if ") + reg_name(i.b) + " == " + std::to_string(i.offset) + " then jump to " +
-                   reg_name(i.a);
+            return std::string("if ") + rn(i.b) + " == " + std::to_string(i.offset) + " then jump to " +
+                   rn(i.a);
           case opcode::bvn:
-            return std::string("if ") + reg_name(i.b) + " != " + std::to_string(i.offset) + " then jump to " +
-                   reg_name(i.a);
+            return std::string("if ") + rn(i.b) + " != " + std::to_string(i.offset) + " then jump to " +
+                   rn(i.a);
           case opcode::seq:
-            return std::string(reg_name(i.a)) + " = (" + reg_name(i.b) + " == " + std::to_string(i.offset) +
+            return std::string(rn(i.a)) + " = (" + rn(i.b) + " == " + std::to_string(i.offset) +
                    " ? 1 : 0)";
           default:
             return "unknown reg+reg+immediate operation";
@@ -300,39 +303,39 @@ inline std::string describe_execution(const instruction& inst) {
         } else if constexpr (std::is_same_v<T, inst_op_reg_imm8x2>) {
           switch (i.op) {
           case opcode::sia:
-            return std::string(reg_name(i.a)) + " += (" + std::to_string(i.v0) + " << " + std::to_string(i.v1) + ")";
+            return std::string(rn(i.a)) + " += (" + std::to_string(i.v0) + " << " + std::to_string(i.v1) + ")";
           default:
             return "unknown reg+two-immediate operation";
           }
         } else if constexpr (std::is_same_v<T, inst_op_reg_reg_reg>) {
           switch (i.op) {
           case opcode::add:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " + " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " + " + rn(i.c);
           case opcode::sub:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " - " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " - " + rn(i.c);
           case opcode::mul:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " * " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " * " + rn(i.c);
           case opcode::div:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " / " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " / " + rn(i.c);
           case opcode::mod:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " % " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " % " + rn(i.c);
           case opcode::and_:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " & " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " & " + rn(i.c);
           case opcode::orr:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " | " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " | " + rn(i.c);
           case opcode::xor_:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " ^ " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " ^ " + rn(i.c);
           case opcode::lsh:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " << " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " << " + rn(i.c);
           case opcode::ash:
-            return std::string(reg_name(i.a)) + " = " + reg_name(i.b) + " >>> " + reg_name(i.c);
+            return std::string(rn(i.a)) + " = " + rn(i.b) + " >>> " + rn(i.c);
           case opcode::tcu:
-            return std::string(reg_name(i.a)) + " = unsigned_compare(" + reg_name(i.b) + ", " + reg_name(i.c) + ")";
+            return std::string(rn(i.a)) + " = unsigned_compare(" + rn(i.b) + ", " + rn(i.c) + ")";
           case opcode::tcs:
-            return std::string(reg_name(i.a)) + " = signed_compare(" + reg_name(i.b) + ", " + reg_name(i.c) + ")";
+            return std::string(rn(i.a)) + " = signed_compare(" + rn(i.b) + ", " + rn(i.c) + ")";
           case opcode::snd:
-            return std::string(reg_name(i.c)) + " = device_send(" + reg_name(i.a) + ", " + reg_name(i.b) + ", " +
-                   reg_name(i.c) + ")";
+            return std::string(rn(i.c)) + " = device_send(" + rn(i.a) + ", " + rn(i.b) + ", " +
+                   rn(i.c) + ")";
           default:
             return "unknown three-register operation";
           }
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "types.hpp"
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace irre {
+
+// bulk field extraction over instruction word streams: callers that scan many
+// instructions (disassemblers, histogrammers, validators) want the opcode and
+// operand bytes of a whole batch without building a variant per word
+
+#if defined(__AVX2__)
+namespace detail {
+
+// gather one byte position of each of the 8 words in v into 8 contiguous
+// bytes; pos is the byte offset within a little-endian word (3 = opcode)
+inline void store_byte_lane(byte* out, __m256i v, int pos) {
+  const __m256i pick = _mm256_setr_epi8(
+      static_cast<char>(pos), static_cast<char>(pos + 4), static_cast<char>(pos + 8), static_cast<char>(pos + 12),
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      static_cast<char>(pos), static_cast<char>(pos + 4), static_cast<char>(pos + 8), static_cast<char>(pos + 12),
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+  );
+  // each 128-bit lane packs its 4 picked bytes into its low dword; the cross-
+  // lane permute then makes the 8 bytes contiguous in the low qword
+  __m256i packed = _mm256_shuffle_epi8(v, pick);
+  __m256i joined = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 1, 1, 1, 1, 1));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(joined));
+}
+
+} // namespace detail
+#endif
+
+// split n instruction words into per-field arrays: ops[i] gets the opcode
+// byte and a/b/c get the three operand bytes from high to low. the operand
+// bytes are raw — for register formats they are register ids, for immediate
+// formats they are immediate fragments — so callers mask by format as needed.
+// on AVX2 targets 8 words are unpacked per iteration with no per-word work.
+inline void decode_fields(const word* in, size_t n, opcode* ops, byte* a, byte* b, byte* c) {
+  size_t i = 0;
+
+#if defined(__AVX2__)
+  for (; i + 8 <= n; i += 8) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    detail::store_byte_lane(reinterpret_cast<byte*>(ops) + i, v, 3);
+    detail::store_byte_lane(a + i, v, 2);
+    detail::store_byte_lane(b + i, v, 1);
+    detail::store_byte_lane(c + i, v, 0);
+  }
+#endif
+
+  for (; i < n; ++i) {
+    word w = in[i];
+    ops[i] = static_cast<opcode>(w >> 24);
+    a[i] = static_cast<byte>(w >> 16);
+    b[i] = static_cast<byte>(w >> 8);
+    c[i] = static_cast<byte>(w);
+  }
+}
+
+// a decoded instruction stream in struct-of-arrays form: one array per field
+// instead of a vector of instruction variants. a consumer that only reads
+// opcodes (a histogrammer, a branch scanner) streams 1 byte per instruction
+// rather than pulling a whole variant through the cache, and the arrays are
+// contiguous for further simd processing
+struct instruction_soa {
+  std::vector<opcode> ops;
+  std::vector<byte> a; // operand byte 2 (first register for register formats)
+  std::vector<byte> b; // operand byte 1
+  std::vector<byte> c; // operand byte 0
+  std::vector<word> imm; // low 24 operand bits; mask to the format's width
+
+  size_t size() const { return ops.size(); }
+
+  void clear() {
+    ops.clear();
+    a.clear();
+    b.clear();
+    c.clear();
+    imm.clear();
+  }
+};
+
+// unpack n instruction words into soa form, replacing any previous contents.
+// fields are raw (no opcode or register validation) — run the words through
+// codec::decode first if the stream is untrusted
+inline void to_soa(const word* words, size_t n, instruction_soa& out) {
+  out.ops.resize(n);
+  out.a.resize(n);
+  out.b.resize(n);
+  out.c.resize(n);
+  out.imm.resize(n);
+
+  decode_fields(words, n, out.ops.data(), out.a.data(), out.b.data(), out.c.data());
+
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i lo24 = _mm256_set1_epi32(0x00ffffff);
+  for (; i + 8 <= n; i += 8) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.imm.data() + i), _mm256_and_si256(v, lo24));
+  }
+#endif
+  for (; i < n; ++i) {
+    out.imm[i] = words[i] & 0x00ffffff;
+  }
+}
+
+} // namespace irre
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <string_view>
 
 namespace irre {
 // basic types for irre architecture
@@ -66,90 +68,29 @@ enum class reg : uint8_t {
   sp = 0x24  // stack pointer
 };
 
-// register utility functions
+// register utility functions; is_gpr is a single compare, and is_special
+// tests one bit in a 64-bit membership mask instead of a pair of range checks
 constexpr bool is_gpr(reg r) { return static_cast<uint8_t>(r) <= 0x1f; }
 
-constexpr bool is_special(reg r) { return static_cast<uint8_t>(r) >= 0x20 && static_cast<uint8_t>(r) <= 0x24; }
+inline constexpr uint64_t k_special_reg_mask =
+    (uint64_t{1} << static_cast<unsigned>(reg::pc)) | (uint64_t{1} << static_cast<unsigned>(reg::lr)) |
+    (uint64_t{1} << static_cast<unsigned>(reg::ad)) | (uint64_t{1} << static_cast<unsigned>(reg::at)) |
+    (uint64_t{1} << static_cast<unsigned>(reg::sp));
 
-constexpr const char* reg_name(reg r) {
-  switch (r) {
-  case reg::r0:
-    return "r0";
-  case reg::r1:
-    return "r1";
-  case reg::r2:
-    return "r2";
-  case reg::r3:
-    return "r3";
-  case reg::r4:
-    return "r4";
-  case reg::r5:
-    return "r5";
-  case reg::r6:
-    return "r6";
-  case reg::r7:
-    return "r7";
-  case reg::r8:
-    return "r8";
-  case reg::r9:
-    return "r9";
-  case reg::r10:
-    return "r10";
-  case reg::r11:
-    return "r11";
-  case reg::r12:
-    return "r12";
-  case reg::r13:
-    return "r13";
-  case reg::r14:
-    return "r14";
-  case reg::r15:
-    return "r15";
-  case reg::r16:
-    return "r16";
-  case reg::r17:
-    return "r17";
-  case reg::r18:
-    return "r18";
-  case reg::r19:
-    return "r19";
-  case reg::r20:
-    return "r20";
-  case reg::r21:
-    return "r21";
-  case reg::r22:
-    return "r22";
-  case reg::r23:
-    return "r23";
-  case reg::r24:
-    return "r24";
-  case reg::r25:
-    return "r25";
-  case reg::r26:
-    return "r26";
-  case reg::r27:
-    return "r27";
-  case reg::r28:
-    return "r28";
-  case reg::r29:
-    return "r29";
-  case reg::r30:
-    return "r30";
-  case reg::r31:
-    return "r31";
-  case reg::pc:
-    return "pc";
-  case reg::lr:
-    return "lr";
-  case reg::ad:
-    return "ad";
-  case reg::at:
-    return "at";
-  case reg::sp:
-    return "sp";
-  default:
-    return "???";
-  }
+constexpr bool is_special(reg r) {
+  return static_cast<uint8_t>(r) < 64 && ((k_special_reg_mask >> static_cast<uint8_t>(r)) & 1u);
+}
+
+// register names indexed by id; a single table load replaces the 37-arm switch
+inline constexpr std::array<std::string_view, 37> k_reg_names = {
+    "r0",  "r1",  "r2",  "r3",  "r4",  "r5",  "r6",  "r7",  "r8",  "r9",  "r10", "r11", "r12",
+    "r13", "r14", "r15", "r16", "r17", "r18", "r19", "r20", "r21", "r22", "r23", "r24", "r25",
+    "r26", "r27", "r28", "r29", "r30", "r31", "pc",  "lr",  "ad",  "at",  "sp"
+};
+
+constexpr std::string_view reg_name(reg r) {
+  auto idx = static_cast<size_t>(r);
+  return idx < k_reg_names.size() ? k_reg_names[idx] : std::string_view{"???"};
 }
 
 // irre instruction opcodes
@@ -208,84 +149,57 @@ enum class opcode : uint8_t {
 
 // opcode metadata for instruction decoding
 struct opcode_info {
-  const char* mnemonic;
+  std::string_view mnemonic;
   format fmt;
 };
 
-constexpr opcode_info get_opcode_info(opcode op) {
-  switch (op) {
-  case opcode::nop:
-    return {"nop", format::op};
-  case opcode::add:
-    return {"add", format::op_reg_reg_reg};
-  case opcode::sub:
-    return {"sub", format::op_reg_reg_reg};
-  case opcode::and_:
-    return {"and", format::op_reg_reg_reg};
-  case opcode::orr:
-    return {"orr", format::op_reg_reg_reg};
-  case opcode::xor_:
-    return {"xor", format::op_reg_reg_reg};
-  case opcode::not_:
-    return {"not", format::op_reg_reg};
-  case opcode::lsh:
-    return {"lsh", format::op_reg_reg_reg};
-  case opcode::ash:
-    return {"ash", format::op_reg_reg_reg};
-  case opcode::tcu:
-    return {"tcu", format::op_reg_reg_reg};
-  case opcode::tcs:
-    return {"tcs", format::op_reg_reg_reg};
-  case opcode::set:
-    return {"set", format::op_reg_imm16};
-  case opcode::mov:
-    return {"mov", format::op_reg_reg};
-  case opcode::ldw:
-    return {"ldw", format::op_reg_reg_imm8};
-  case opcode::stw:
-    return {"stw", format::op_reg_reg_imm8};
-  case opcode::ldb:
-    return {"ldb", format::op_reg_reg_imm8};
-  case opcode::stb:
-    return {"stb", format::op_reg_reg_imm8};
-  case opcode::jmi:
-    return {"jmi", format::op_imm24};
-  case opcode::jmp:
-    return {"jmp", format::op_reg};
-  case opcode::bve:
-    return {"bve", format::op_reg_reg_imm8};
-  case opcode::bvn:
-    return {"bvn", format::op_reg_reg_imm8};
-  case opcode::cal:
-    return {"cal", format::op_reg};
-  case opcode::ret:
-    return {"ret", format::op};
-  case opcode::mul:
-    return {"mul", format::op_reg_reg_reg};
-  case opcode::div:
-    return {"div", format::op_reg_reg_reg};
-  case opcode::mod:
-    return {"mod", format::op_reg_reg_reg};
-  case opcode::sia:
-    return {"sia", format::op_reg_imm8x2};
-  case opcode::sup:
-    return {"sup", format::op_reg_imm16};
-  case opcode::sxt:
-    return {"sxt", format::op_reg_reg};
-  case opcode::seq:
-    return {"seq", format::op_reg_reg_imm8};
-  case opcode::int_:
-    return {"int", format::op_imm24};
-  case opcode::snd:
-    return {"snd", format::op_reg_reg_reg};
-  case opcode::hlt:
-    return {"hlt", format::op};
-  default:
-    return {"???", format::invalid};
+// opcode metadata in a dense 256-entry table indexed by the raw opcode byte:
+// a query is one L1 load with no switch, and undefined slots carry the
+// invalid marker
+inline constexpr std::array<opcode_info, 256> k_opcode_table = [] {
+  std::array<opcode_info, 256> t{};
+  for (auto& e : t) {
+    e = {"???", format::invalid};
   }
-}
+  t[static_cast<size_t>(opcode::nop)] = {"nop", format::op};
+  t[static_cast<size_t>(opcode::add)] = {"add", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::sub)] = {"sub", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::and_)] = {"and", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::orr)] = {"orr", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::xor_)] = {"xor", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::not_)] = {"not", format::op_reg_reg};
+  t[static_cast<size_t>(opcode::lsh)] = {"lsh", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::ash)] = {"ash", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::tcu)] = {"tcu", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::tcs)] = {"tcs", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::set)] = {"set", format::op_reg_imm16};
+  t[static_cast<size_t>(opcode::mov)] = {"mov", format::op_reg_reg};
+  t[static_cast<size_t>(opcode::ldw)] = {"ldw", format::op_reg_reg_imm8};
+  t[static_cast<size_t>(opcode::stw)] = {"stw", format::op_reg_reg_imm8};
+  t[static_cast<size_t>(opcode::ldb)] = {"ldb", format::op_reg_reg_imm8};
+  t[static_cast<size_t>(opcode::stb)] = {"stb", format::op_reg_reg_imm8};
+  t[static_cast<size_t>(opcode::jmi)] = {"jmi", format::op_imm24};
+  t[static_cast<size_t>(opcode::jmp)] = {"jmp", format::op_reg};
+  t[static_cast<size_t>(opcode::bve)] = {"bve", format::op_reg_reg_imm8};
+  t[static_cast<size_t>(opcode::bvn)] = {"bvn", format::op_reg_reg_imm8};
+  t[static_cast<size_t>(opcode::cal)] = {"cal", format::op_reg};
+  t[static_cast<size_t>(opcode::ret)] = {"ret", format::op};
+  t[static_cast<size_t>(opcode::mul)] = {"mul", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::div)] = {"div", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::mod)] = {"mod", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::sia)] = {"sia", format::op_reg_imm8x2};
+  t[static_cast<size_t>(opcode::sup)] = {"sup", format::op_reg_imm16};
+  t[static_cast<size_t>(opcode::sxt)] = {"sxt", format::op_reg_reg};
+  t[static_cast<size_t>(opcode::seq)] = {"seq", format::op_reg_reg_imm8};
+  t[static_cast<size_t>(opcode::int_)] = {"int", format::op_imm24};
+  t[static_cast<size_t>(opcode::snd)] = {"snd", format::op_reg_reg_reg};
+  t[static_cast<size_t>(opcode::hlt)] = {"hlt", format::op};
+  return t;
+}();
+
+constexpr opcode_info get_opcode_info(opcode op) { return k_opcode_table[static_cast<uint8_t>(op)]; }
 
 constexpr format get_format(opcode op) { return get_opcode_info(op).fmt; }
 
-constexpr const char* get_mnemonic(opcode op) { return get_opcode_info(op).mnemonic; }
+constexpr std::string_view get_mnemonic(opcode op) { return get_opcode_info(op).mnemonic; }
 } // namespace irre
\ No newline at end of file
@@ -1,68 +1,409 @@
 #include "disassembler.hpp"
-#include <iomanip>
 #include <fstream>
 #include <algorithm>
+#include <cstring>
 #include <optional>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace irre::assembler {
 
+namespace {
+
+// per-format operand printers; each takes the variant and extracts the one
+// alternative its opcodes decode to
+void format_none(std::string&, const instruction&) {}
+
+void format_r(std::string& out, const instruction& inst) {
+  const auto& i = std::get<inst_op_reg>(inst);
+  out.push_back(' ');
+  out.append(reg_name(i.a));
+}
+
+void format_imm24(std::string& out, const instruction& inst) {
+  const auto& i = std::get<inst_op_imm24>(inst);
+  char buf[16];
+  std::snprintf(buf, sizeof(buf), " 0x%06x", i.addr);
+  out.append(buf);
+}
+
+void format_r_imm16(std::string& out, const instruction& inst) {
+  const auto& i = std::get<inst_op_reg_imm16>(inst);
+  out.push_back(' ');
+  out.append(reg_name(i.a));
+  char buf[16];
+  std::snprintf(buf, sizeof(buf), " 0x%04x", i.imm);
+  out.append(buf);
+}
+
+void format_rr(std::string& out, const instruction& inst) {
+  const auto& i = std::get<inst_op_reg_reg>(inst);
+  out.push_back(' ');
+  out.append(reg_name(i.a));
+  out.push_back(' ');
+  out.append(reg_name(i.b));
+}
+
+void format_rr_imm8(std::string& out, const instruction& inst) {
+  const auto& i = std::get<inst_op_reg_reg_imm8>(inst);
+  out.push_back(' ');
+  out.append(reg_name(i.a));
+  out.push_back(' ');
+  out.append(reg_name(i.b));
+  char buf[16];
+  std::snprintf(buf, sizeof(buf), " 0x%02x", i.offset);
+  out.append(buf);
+}
+
+void format_r_imm8x2(std::string& out, const instruction& inst) {
+  const auto& i = std::get<inst_op_reg_imm8x2>(inst);
+  out.push_back(' ');
+  out.append(reg_name(i.a));
+  char buf[16];
+  std::snprintf(buf, sizeof(buf), " 0x%02x 0x%02x", i.v0, i.v1);
+  out.append(buf);
+}
+
+void format_rrr(std::string& out, const instruction& inst) {
+  const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+  out.push_back(' ');
+  out.append(reg_name(i.a));
+  out.push_back(' ');
+  out.append(reg_name(i.b));
+  out.push_back(' ');
+  out.append(reg_name(i.c));
+}
+
+// formatter table indexed by opcode byte: interned mnemonic plus the operand
+// printer for that opcode's format, so the hot path is one table load and one
+// well-predicted indirect call instead of mnemonic switch + variant visit
+struct format_entry {
+  std::string_view name;
+  void (*fmt)(std::string&, const instruction&);
+};
+
+constexpr auto k_ops = [] {
+  std::array<format_entry, 256> table{};
+  for (size_t i = 0; i < table.size(); ++i) {
+    auto info = get_opcode_info(static_cast<opcode>(i));
+    table[i].name = info.mnemonic;
+    switch (info.fmt) {
+    case format::op:
+      table[i].fmt = format_none;
+      break;
+    case format::op_reg:
+      table[i].fmt = format_r;
+      break;
+    case format::op_imm24:
+      table[i].fmt = format_imm24;
+      break;
+    case format::op_reg_imm16:
+      table[i].fmt = format_r_imm16;
+      break;
+    case format::op_reg_reg:
+      table[i].fmt = format_rr;
+      break;
+    case format::op_reg_reg_imm8:
+      table[i].fmt = format_rr_imm8;
+      break;
+    case format::op_reg_imm8x2:
+      table[i].fmt = format_r_imm8x2;
+      break;
+    case format::op_reg_reg_reg:
+      table[i].fmt = format_rrr;
+      break;
+    case format::invalid:
+      // unmapped opcodes print just the "???" mnemonic; a null pointer here
+      // would crash disassemble_instruction on any instruction carrying one
+      table[i].fmt = format_none;
+      break;
+    }
+  }
+  return table;
+}();
+
+constexpr char k_hex_digits[] = "0123456789abcdef";
+
+// byte -> "xx" pair table so hex dumps append two chars per byte with a
+// single L1-resident lookup instead of per-nibble arithmetic
+constexpr auto k_hex_pairs = [] {
+  std::array<std::array<char, 2>, 256> table{};
+  for (size_t i = 0; i < table.size(); ++i) {
+    table[i] = {k_hex_digits[i >> 4], k_hex_digits[i & 0xf]};
+  }
+  return table;
+}();
+
+// spread the 4 bytes of a 32-bit value to the even byte lanes of a 64-bit one
+constexpr uint64_t spread_bytes(uint64_t x) {
+  x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+  x = (x | (x << 8)) & 0x00ff00ff00ff00ffull;
+  return x;
+}
+
+// hex-encode 8 bytes into 16 chars with SWAR nibble-to-ascii: split nibbles,
+// zip them into byte lanes, then add '0' plus a branchless a-f correction.
+// relies on little-endian host order like the rest of the decode path.
+void append_hex8_swar(std::string& out, const byte* p) {
+  char buf[16];
+
+  for (int half = 0; half < 2; ++half) {
+    uint32_t v;
+    std::memcpy(&v, p + half * 4, 4);
+
+    // nibble values interleaved into the 8 output byte lanes
+    uint64_t n = spread_bytes((v >> 4) & 0x0f0f0f0f) | (spread_bytes(v & 0x0f0f0f0f) << 8);
+
+    // ascii: '0' + n, plus 39 ('a' - '9' - 1) for lanes holding a-f
+    uint64_t gt9 = ((n + 0x0606060606060606ull) & 0x1010101010101010ull) >> 4;
+    uint64_t chars = n + 0x3030303030303030ull + gt9 * 39;
+
+    std::memcpy(buf + half * 8, &chars, 8);
+  }
+
+  out.append(buf, 16);
+}
+
+// append a hex value with "0x" prefix, zero-padded to at least min_digits,
+// using a nibble lookup table instead of ostream formatting machinery
+void append_hex(std::string& out, uint32_t v, int min_digits) {
+  char buf[8];
+  int n = 0;
+  do {
+    buf[n++] = k_hex_digits[v & 0xf];
+    v >>= 4;
+  } while (v != 0);
+  while (n < min_digits) {
+    buf[n++] = '0';
+  }
+
+  out.append("0x", 2);
+  while (n > 0) {
+    out.push_back(buf[--n]);
+  }
+}
+
+// append an address as "0x%04x" (wider if it doesn't fit in 16 bits)
+void append_hex_addr(std::string& out, uint32_t v) { append_hex(out, v, 4); }
+
+// append the assembly text for an instruction (mnemonic + operands)
+void append_assembly(std::string& out, const instruction& inst) {
+  const format_entry& e = k_ops[static_cast<size_t>(get_opcode(inst))];
+  out.append(e.name);
+  e.fmt(out, inst);
+}
+
+// a decoded line: either a valid instruction or an error annotation
+struct disasm_entry {
+  std::optional<instruction> inst;
+  std::string error_msg;
+  bool is_error = false;
+};
+
+// decode a single instruction word into an entry, turning decode failures
+// into error annotations rather than aborting the whole disassembly
+disasm_entry make_entry(word w) {
+  auto inst_result = codec::decode(w);
+  if (inst_result.is_ok()) {
+    return {inst_result.value(), "", false};
+  }
+
+  std::string error_msg;
+  error_msg.reserve(64);
+  error_msg += "; ERROR: ";
+  error_msg += decode_error_message(inst_result.error());
+  error_msg += " (";
+  append_hex(error_msg, w, 8);
+  error_msg += " = ";
+  for (int shift = 0; shift < 32; shift += 8) {
+    if (shift != 0) {
+      error_msg += ' ';
+    }
+    error_msg.append(k_hex_pairs[(w >> shift) & 0xff].data(), 2);
+  }
+  error_msg += ')';
+
+  return {std::nullopt, std::move(error_msg), true};
+}
+
+#if defined(__AVX2__)
+// build the variant for a word whose opcode and register fields have already
+// been validated, skipping codec::decode's per-field checks
+instruction decode_unchecked(word w) {
+  switch (get_format(static_cast<opcode>((w >> 24) & 0xff))) {
+  case format::op_reg:
+    return inst_op_reg::decode(w);
+  case format::op_imm24:
+    return inst_op_imm24::decode(w);
+  case format::op_reg_imm16:
+    return inst_op_reg_imm16::decode(w);
+  case format::op_reg_reg:
+    return inst_op_reg_reg::decode(w);
+  case format::op_reg_reg_imm8:
+    return inst_op_reg_reg_imm8::decode(w);
+  case format::op_reg_imm8x2:
+    return inst_op_reg_imm8x2::decode(w);
+  case format::op_reg_reg_reg:
+    return inst_op_reg_reg_reg::decode(w);
+  case format::op:
+  default:
+    return inst_op::decode(w);
+  }
+}
+
+// how many leading operand bytes of a format hold register ids (fields are
+// packed in order a, b, c from the high operand byte down)
+constexpr int reg_operand_count(format f) {
+  switch (f) {
+  case format::op_reg:
+  case format::op_reg_imm16:
+  case format::op_reg_imm8x2:
+    return 1;
+  case format::op_reg_reg:
+  case format::op_reg_reg_imm8:
+    return 2;
+  case format::op_reg_reg_reg:
+    return 3;
+  default:
+    return 0;
+  }
+}
+
+// opcode-set membership via nibble-pair lookup: each high-nibble row in use
+// (0x0_, 0x1_, 0x2_, 0x3_, 0x4_, 0xf_) gets a bit, and a low-nibble table
+// holds the union of row bits whose opcode is in the set at that column; an
+// opcode is a member iff the two lookups intersect
+constexpr std::array<uint8_t, 16> k_row_bits = {0x01, 0x02, 0x04, 0x08, 0x10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x20};
+
+// column unions for the set of valid opcodes with at least min_regs register
+// operands (min_regs == 0 selects every valid opcode)
+constexpr std::array<uint8_t, 16> make_lo_lut(int min_regs) {
+  std::array<uint8_t, 16> lut{};
+  for (int op = 0; op < 256; ++op) {
+    format f = get_opcode_info(static_cast<opcode>(op)).fmt;
+    if (f != format::invalid && reg_operand_count(f) >= min_regs) {
+      lut[op & 0xf] = static_cast<uint8_t>(lut[op & 0xf] | k_row_bits[op >> 4]);
+    }
+  }
+  return lut;
+}
+
+constexpr auto k_lo_valid = make_lo_lut(0);
+constexpr auto k_lo_reg1 = make_lo_lut(1);
+constexpr auto k_lo_reg2 = make_lo_lut(2);
+constexpr auto k_lo_reg3 = make_lo_lut(3);
+
+// broadcast a 16-byte lut into both shuffle lanes
+inline __m256i load_lut(const std::array<uint8_t, 16>& lut) {
+  return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.data())));
+}
+
+// validate 8 consecutive instructions (32 bytes) in one shot: opcodes against
+// the valid set and register operand bytes against the register-id range, so
+// all-valid runs decode without any per-instruction checks
+bool validate_8_instructions(const byte* p) {
+  const __m256i row_bits = load_lut(k_row_bits);
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i byte0 = _mm256_set1_epi32(0xff);
+
+  __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  // opcodes live in byte 3 of each little-endian word; shift them to byte 0
+  __m256i op_hi = _mm256_srli_epi32(v, 28);
+  __m256i op_lo = _mm256_and_si256(_mm256_srli_epi32(v, 24), _mm256_set1_epi32(0x0f));
+  __m256i hi_bits = _mm256_shuffle_epi8(row_bits, op_hi);
+
+  // per-word membership masks: byte 0 of each dword holds the intersection
+  auto member = [&](const std::array<uint8_t, 16>& lo_lut) {
+    __m256i m = _mm256_and_si256(hi_bits, _mm256_shuffle_epi8(load_lut(lo_lut), op_lo));
+    return _mm256_cmpgt_epi32(_mm256_and_si256(m, byte0), zero);
+  };
+
+  __m256i bad = _mm256_andnot_si256(member(k_lo_valid), _mm256_set1_epi8(-1));
+
+  // register fields pack downward from byte 2; a byte is bad if its format
+  // says it holds a register id and its value exceeds the largest id (sp)
+  __m256i over = _mm256_subs_epu8(v, _mm256_set1_epi8(0x24));
+  __m256i need = _mm256_or_si256(
+      _mm256_or_si256(
+          _mm256_and_si256(member(k_lo_reg1), _mm256_set1_epi32(0x00ff0000)),
+          _mm256_and_si256(member(k_lo_reg2), _mm256_set1_epi32(0x0000ff00))
+      ),
+      _mm256_and_si256(member(k_lo_reg3), _mm256_set1_epi32(0x000000ff))
+  );
+  bad = _mm256_or_si256(bad, _mm256_and_si256(over, need));
+
+  return _mm256_testz_si256(bad, bad) != 0;
+}
+#endif
+
+// decode a byte stream into entries; on AVX2 targets, batch-validate 8
+// instructions at a time and decode validated blocks on the unchecked path
+std::vector<disasm_entry> decode_entries(const byte* data, size_t size) {
+  std::vector<disasm_entry> entries;
+  entries.reserve(size / 4);
+
+  size_t i = 0;
+
+#if defined(__AVX2__)
+  while (i + 32 <= size && validate_8_instructions(data + i)) {
+    for (size_t j = 0; j < 8; ++j, i += 4) {
+      word w;
+      std::memcpy(&w, data + i, 4);
+      entries.push_back({decode_unchecked(w), "", false});
+    }
+  }
+#endif
+
+  // scalar path: handles the tail and any block containing an invalid opcode
+  for (; i < size; i += 4) {
+    // load the whole instruction as a single 32-bit word; the wire format is
+    // little-endian, which matches host byte order on our supported targets
+    word w;
+    std::memcpy(&w, data + i, 4);
+    entries.push_back(make_entry(w));
+  }
+
+  return entries;
+}
+
+} // namespace
+
 result<std::string, disasm_error> disassembler::disassemble_object(const object_file& obj, disasm_format fmt) {
   if (obj.code.empty()) {
     return std::string(""); // empty object file
   }
 
-  // decode instruction sequence from code section, handling errors gracefully
-  struct disasm_entry {
-    std::optional<instruction> inst;
-    std::string error_msg;
-    bool is_error = false;
-  };
-  
-  std::vector<disasm_entry> entries;
-  
   if (obj.code.size() % 4 != 0) {
     return disasm_error::invalid_size;
   }
 
-  entries.reserve(obj.code.size() / 4);
-  for (size_t i = 0; i < obj.code.size(); i += 4) {
-    auto inst_result = codec::decode_bytes(&obj.code[i]);
-    if (inst_result.is_ok()) {
-      entries.push_back({inst_result.value(), "", false});
-    } else {
-      // Create an error entry for invalid instructions
-      word invalid_word = static_cast<word>(obj.code[i]) | 
-                         (static_cast<word>(obj.code[i+1]) << 8) |
-                         (static_cast<word>(obj.code[i+2]) << 16) |
-                         (static_cast<word>(obj.code[i+3]) << 24);
-      
-      std::ostringstream error_msg;
-      error_msg << "; ERROR: " << decode_error_message(inst_result.error()) 
-                << " (0x" << std::hex << std::setfill('0') << std::setw(8) << invalid_word
-                << " = " << std::hex << std::setfill('0') << std::setw(2) 
-                << static_cast<int>(obj.code[i]) << " "
-                << std::hex << std::setfill('0') << std::setw(2) 
-                << static_cast<int>(obj.code[i+1]) << " "
-                << std::hex << std::setfill('0') << std::setw(2) 
-                << static_cast<int>(obj.code[i+2]) << " "
-                << std::hex << std::setfill('0') << std::setw(2) 
-                << static_cast<int>(obj.code[i+3]) << ")";
-      
-      entries.push_back({std::nullopt, error_msg.str(), true});
-    }
-  }
+  // decode instruction sequence from code section, handling errors gracefully
+  std::vector<disasm_entry> entries = decode_entries(obj.code.data(), obj.code.size());
 
-  std::ostringstream output;
+  // single output buffer sized once up front: header + ~48 chars per
+  // annotated code line + 2 chars per data byte (plus data line overhead),
+  // so code and data emission never trigger geometric string growth
+  std::string output;
+  output.reserve(128 + entries.size() * 48 + (obj.data.empty() ? 0 : 64 + 2 * obj.data.size() + obj.data.size() / 16 * 10));
 
   // add header comment for object file info
   if (fmt == disasm_format::annotated) {
-    output << "; irre object file disassembly\n";
-    output << "; entry point: 0x" << std::hex << obj.entry_offset << std::dec << "\n";
-    output << "; code size: " << obj.code.size() << " bytes (" << entries.size() << " instructions)\n";
+    output += "; irre object file disassembly\n; entry point: ";
+    append_hex(output, obj.entry_offset, 1);
+    output += "\n; code size: ";
+    output += std::to_string(obj.code.size());
+    output += " bytes (";
+    output += std::to_string(entries.size());
+    output += " instructions)\n";
     if (!obj.data.empty()) {
-      output << "; data size: " << obj.data.size() << " bytes\n";
+      output += "; data size: ";
+      output += std::to_string(obj.data.size());
+      output += " bytes\n";
     }
-    output << "\n";
+    output += "\n";
   }
 
   // disassemble each entry (instruction or error)
@@ -72,103 +413,81 @@ result<std::string, disasm_error> disassembler::disassemble_object(const object_
 
     if (entry.is_error) {
       // Show error message with address
-      output << format_address(addr) << ": " << entry.error_msg;
+      output += format_address(addr);
+      output += ": ";
+      output += entry.error_msg;
     } else {
       // extract raw bytes for this instruction
-      std::vector<byte> inst_bytes;
-      if (i * 4 + 4 <= obj.code.size()) {
-        inst_bytes.assign(obj.code.begin() + i * 4, obj.code.begin() + i * 4 + 4);
-      }
+      std::vector<byte> inst_bytes(obj.code.begin() + i * 4, obj.code.begin() + i * 4 + 4);
 
       auto line_result = disassemble_instruction(entry.inst.value(), addr, &inst_bytes);
       if (line_result.is_err()) {
         return line_result.error();
       }
 
-      output << line_result.value();
+      output += line_result.value();
     }
 
     if (i < entries.size() - 1) {
-      output << "\n";
+      output += "\n";
     }
   }
 
   // add data section if present
   if (!obj.data.empty() && fmt == disasm_format::annotated) {
-    output << "\n\n; data section (" << obj.data.size() << " bytes)\n";
+    output += "\n\n; data section (";
+    output += std::to_string(obj.data.size());
+    output += " bytes)\n";
     uint32_t data_addr = static_cast<uint32_t>(obj.code.size());
 
     for (size_t i = 0; i < obj.data.size(); i += 16) {
-      output << format_address(data_addr + i) << ": ";
+      output += format_address(data_addr + i);
+      output += ": ";
 
-      // hex bytes (up to 16 per line)
+      // hex bytes (up to 16 per line), 8 at a time via the SWAR encoder
       size_t line_end = std::min(i + 16, obj.data.size());
-      for (size_t j = i; j < line_end; ++j) {
-        output << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(obj.data[j]);
+      size_t j = i;
+      for (; j + 8 <= line_end; j += 8) {
+        append_hex8_swar(output, obj.data.data() + j);
+      }
+      for (; j < line_end; ++j) {
+        output.append(k_hex_pairs[obj.data[j]].data(), 2);
       }
 
       if (i + 16 < obj.data.size()) {
-        output << "\n";
+        output += "\n";
       }
     }
-    output << std::dec; // reset to decimal
   }
 
-  return output.str();
+  return output;
 }
 
-result<std::string, disasm_error> disassembler::disassemble_bytes(const std::vector<byte>& bytes, disasm_format fmt) {
-  if (bytes.empty()) {
+result<std::string, disasm_error> disassembler::disassemble_bytes(const byte* data, size_t size, disasm_format fmt) {
+  if (size == 0) {
     return std::string(""); // empty input
   }
 
-  if (bytes.size() % 4 != 0) {
+  if (size % 4 != 0) {
     return disasm_error::invalid_size;
   }
 
   // decode instruction sequence, handling errors gracefully
-  struct disasm_entry {
-    std::optional<instruction> inst;
-    std::string error_msg;
-    bool is_error = false;
-  };
-  
-  std::vector<disasm_entry> entries;
-  entries.reserve(bytes.size() / 4);
-  
-  for (size_t i = 0; i < bytes.size(); i += 4) {
-    auto inst_result = codec::decode_bytes(&bytes[i]);
-    if (inst_result.is_ok()) {
-      entries.push_back({inst_result.value(), "", false});
-    } else {
-      // Create an error entry for invalid instructions
-      word invalid_word = static_cast<word>(bytes[i]) | 
-                         (static_cast<word>(bytes[i+1]) << 8) |
-                         (static_cast<word>(bytes[i+2]) << 16) |
-                         (static_cast<word>(bytes[i+3]) << 24);
-      
-      std::ostringstream error_msg;
-      error_msg << "; ERROR: " << decode_error_message(inst_result.error()) 
-                << " (0x" << std::hex << std::setfill('0') << std::setw(8) << invalid_word
-                << " = " << std::hex << std::setfill('0') << std::setw(2) 
-                << static_cast<int>(bytes[i]) << " "
-                << std::hex << std::setfill('0') << std::setw(2) 
-                << static_cast<int>(bytes[i+1]) << " "
-                << std::hex << std::setfill('0') << std::setw(2) 
-                << static_cast<int>(bytes[i+2]) << " "
-                << std::hex << std::setfill('0') << std::setw(2) 
-                << static_cast<int>(bytes[i+3]) << ")";
-      
-      entries.push_back({std::nullopt, error_msg.str(), true});
-    }
-  }
-  std::ostringstream output;
+  std::vector<disasm_entry> entries = decode_entries(data, size);
+
+  // single output buffer sized once up front (~48 chars per annotated line)
+  std::string output;
+  output.reserve(96 + entries.size() * 48);
 
   // add header comment for raw bytes
   if (fmt == disasm_format::annotated) {
-    output << "; raw bytes disassembly\n";
-    output << "; base address: 0x" << std::hex << options_.base_address << std::dec << "\n";
-    output << "; size: " << bytes.size() << " bytes (" << entries.size() << " instructions)\n\n";
+    output += "; raw bytes disassembly\n; base address: ";
+    append_hex(output, options_.base_address, 1);
+    output += "\n; size: ";
+    output += std::to_string(size);
+    output += " bytes (";
+    output += std::to_string(entries.size());
+    output += " instructions)\n\n";
   }
 
   // disassemble each entry (instruction or error)
@@ -178,99 +497,105 @@ result<std::string, disasm_error> disassembler::disassemble_bytes(const std::vec
 
     if (entry.is_error) {
       // Show error message with address
-      output << format_address(addr) << ": " << entry.error_msg;
+      output += format_address(addr);
+      output += ": ";
+      output += entry.error_msg;
     } else {
       // extract raw bytes for this instruction
-      std::vector<byte> inst_bytes(bytes.begin() + i * 4, bytes.begin() + i * 4 + 4);
+      std::vector<byte> inst_bytes(data + i * 4, data + i * 4 + 4);
 
       auto line_result = disassemble_instruction(entry.inst.value(), addr, &inst_bytes);
       if (line_result.is_err()) {
         return line_result.error();
       }
 
-      output << line_result.value();
+      output += line_result.value();
     }
 
     if (i < entries.size() - 1) {
-      output << "\n";
+      output += "\n";
     }
   }
 
-  return output.str();
+  return output;
 }
 
 result<std::string, disasm_error> disassembler::disassemble_instruction(
     const instruction& inst, uint32_t addr, const std::vector<byte>* raw_bytes
 ) {
-  std::ostringstream output;
-
-  // get assembly representation
-  std::string assembly = format_instruction(inst);
+  // fast path: annotations disabled, output is just mnemonic + operands with
+  // no address/hex branching at all
+  if (!options_.show_addresses && !options_.show_hex_bytes) {
+    std::string assembly;
+    append_assembly(assembly, inst);
+    return assembly;
+  }
 
-  if (options_.show_addresses || options_.show_hex_bytes) {
-    // annotated format
-    std::vector<byte> bytes;
-    if (raw_bytes) {
-      bytes = *raw_bytes;
-    } else {
-      // encode instruction to get bytes
-      auto encoded_bytes = codec::encode_bytes(inst);
-      bytes.assign(encoded_bytes.begin(), encoded_bytes.end());
-    }
+  // annotated format
+  std::string assembly;
+  append_assembly(assembly, inst);
 
-    output << format_annotated_line(addr, bytes, assembly);
+  std::vector<byte> bytes;
+  if (raw_bytes) {
+    bytes = *raw_bytes;
   } else {
-    // basic format - just assembly
-    output << assembly;
+    // encode instruction to get bytes
+    auto encoded_bytes = codec::encode_bytes(inst);
+    bytes.assign(encoded_bytes.begin(), encoded_bytes.end());
   }
 
-  return output.str();
+  return format_annotated_line(addr, bytes, assembly);
 }
 
 std::string disassembler::format_address(uint32_t addr) const {
-  std::ostringstream ss;
-
   if (options_.address_format == "decimal") {
-    ss << std::dec << std::setfill(' ') << std::setw(8) << addr;
-  } else {
-    // default to hex
-    ss << "0x" << std::hex << std::setfill('0') << std::setw(4) << addr;
+    char buf[16];
+    std::snprintf(buf, sizeof(buf), "%8u", addr);
+    return buf;
   }
 
-  return ss.str();
+  // default to hex
+  std::string out;
+  append_hex_addr(out, addr);
+  return out;
 }
 
 std::string disassembler::format_hex_bytes(const std::vector<byte>& bytes) const {
-  std::ostringstream ss;
+  std::string out;
+  out.reserve(bytes.size() * 2);
 
   // show bytes in the exact order they appear in the file (little-endian)
   for (size_t i = 0; i < bytes.size(); ++i) {
-    ss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(bytes[i]);
+    out.append(k_hex_pairs[bytes[i]].data(), 2);
   }
 
-  return ss.str();
+  return out;
 }
 
 std::string disassembler::format_annotated_line(
     uint32_t addr, const std::vector<byte>& inst_bytes, const std::string& assembly
 ) const {
-  std::ostringstream ss;
+  std::string out;
+  out.reserve(16 + inst_bytes.size() * 2 + assembly.size());
 
   // address column
   if (options_.show_addresses) {
-    ss << format_address(addr) << ": ";
+    out += format_address(addr);
+    out += ": ";
   }
 
   // hex bytes column
   if (options_.show_hex_bytes) {
-    ss << format_hex_bytes(inst_bytes);
-    ss << "  "; // padding between hex and assembly
+    for (byte b : inst_bytes) {
+      out.append(k_hex_pairs[b].data(), 2);
+    }
+    out += "  "; // padding between hex and assembly
   }
 
   // assembly column
-  ss << assembly;
+  out += assembly;
 
-  return ss.str();
+  return out;
 }
 
 // convenience functions implementation
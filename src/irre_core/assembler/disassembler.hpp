@@ -7,6 +7,7 @@
 #include "object.hpp"
 #include <vector>
 #include <string>
+#include <string_view>
 #include <sstream>
 
 namespace irre::assembler {
@@ -14,7 +15,7 @@ namespace irre::assembler {
 // disassembler error types
 enum class disasm_error { decode_failed, invalid_size, file_error, empty_input };
 
-constexpr const char* disasm_error_message(disasm_error err) {
+constexpr std::string_view disasm_error_message(disasm_error err) noexcept {
   switch (err) {
   case disasm_error::decode_failed:
     return "failed to decode instructions";
@@ -54,10 +55,17 @@ public:
       const object_file& obj, disasm_format fmt = disasm_format::annotated
   );
 
+  // disassemble raw instruction bytes from a caller buffer
+  result<std::string, disasm_error> disassemble_bytes(
+      const byte* data, size_t size, disasm_format fmt = disasm_format::annotated
+  );
+
   // disassemble raw instruction bytes
   result<std::string, disasm_error> disassemble_bytes(
       const std::vector<byte>& bytes, disasm_format fmt = disasm_format::annotated
-  );
+  ) {
+    return disassemble_bytes(bytes.data(), bytes.size(), fmt);
+  }
 
   // disassemble a single instruction at given address
   result<std::string, disasm_error> disassemble_instruction(
@@ -4,27 +4,39 @@
 
 namespace irre::assembler {
 
-std::vector<byte> object_file::to_binary() const {
-  std::vector<byte> result;
-
-  // calculate total size: 24 byte header + code + data
-  size_t header_size = 24;
-  size_t total_size = header_size + code.size() + data.size();
-
-  result.reserve(total_size);
-
-  // write header using portable utilities
-  byte_io::write_magic(result);                                      // [0-3]: magic 'RGVM'
-  byte_io::write_u16_le(result, version);                            // [4-5]: version
-  byte_io::write_u16_le(result, 0);                                  // [6-7]: reserved
-  byte_io::write_u32_le(result, entry_offset);                       // [8-11]: entry offset
-  byte_io::write_u32_le(result, static_cast<uint32_t>(code.size())); // [12-15]: code size
-  byte_io::write_u32_le(result, static_cast<uint32_t>(data.size())); // [16-19]: data size
-  byte_io::write_u32_le(result, 0);                                  // [20-23]: reserved
+namespace {
+
+// on-disk header layout; field order matches the wire format and the wire
+// format is little-endian, which matches host byte order on our supported
+// targets, so the whole header moves with a single memcpy
+struct obj_header {
+  char magic[4];      // [0-3]: 'RGVM'
+  uint16_t version;   // [4-5]
+  uint16_t reserved0; // [6-7]
+  uint32_t entry;     // [8-11]: entry offset
+  uint32_t code_size; // [12-15]
+  uint32_t data_size; // [16-19]
+  uint32_t reserved1; // [20-23]
+};
+static_assert(sizeof(obj_header) == 24, "object file header must pack to 24 bytes");
+
+} // namespace
 
-  // write sections
-  result.insert(result.end(), code.begin(), code.end());
-  result.insert(result.end(), data.begin(), data.end());
+std::vector<byte> object_file::to_binary() const {
+  // size the buffer once and fill it with three bulk copies: header, code, data
+  std::vector<byte> result(sizeof(obj_header) + code.size() + data.size());
+
+  obj_header header{
+      {'R', 'G', 'V', 'M'}, version, 0, entry_offset, static_cast<uint32_t>(code.size()),
+      static_cast<uint32_t>(data.size()), 0
+  };
+  std::memcpy(result.data(), &header, sizeof(header));
+  if (!code.empty()) {
+    std::memcpy(result.data() + sizeof(header), code.data(), code.size());
+  }
+  if (!data.empty()) {
+    std::memcpy(result.data() + sizeof(header) + code.size(), data.data(), data.size());
+  }
 
   return result;
 }
@@ -46,6 +58,10 @@ result<object_file, std::string> object_file::from_binary(const std::vector<byte
 
   const byte* data = binary.data();
 
+  // read the whole header in one copy, then validate field by field
+  obj_header header;
+  std::memcpy(&header, data, sizeof(header));
+
   // check magic with detailed feedback
   if (!byte_io::check_magic(data)) {
     char actual_magic[5] = {0};
@@ -59,19 +75,17 @@ result<object_file, std::string> object_file::from_binary(const std::vector<byte
     return std::string(msg);
   }
 
-  // read header fields
-  uint16_t file_version = byte_io::read_u16_le(data + 4);
-  if (file_version != version) {
+  if (header.version != version) {
     char msg[128];
     std::snprintf(
-        msg, sizeof(msg), "error: unsupported version %u - this loader supports version %u", file_version, version
+        msg, sizeof(msg), "error: unsupported version %u - this loader supports version %u", header.version, version
     );
     return std::string(msg);
   }
 
-  uint32_t entry_offset = byte_io::read_u32_le(data + 8);
-  uint32_t code_size = byte_io::read_u32_le(data + 12);
-  uint32_t data_size = byte_io::read_u32_le(data + 16);
+  uint32_t entry_offset = header.entry;
+  uint32_t code_size = header.code_size;
+  uint32_t data_size = header.data_size;
 
   // validate section sizes
   if (code_size > 0x1000000) { // 16MB limit
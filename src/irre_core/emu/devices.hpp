@@ -1,8 +1,9 @@
 #pragma once
 
 #include "../arch/types.hpp"
+#include <array>
 #include <memory>
-#include <unordered_map>
+#include <stdexcept>
 #include <string>
 
 namespace irre::emu {
@@ -69,41 +70,52 @@ public:
 };
 
 // device registry for managing devices
+// device ids are small dense integers (see device_ids below), so the registry
+// is a flat array indexed directly by id: one load per access, no hashing
 class device_registry {
 public:
+  static constexpr word max_devices = 16;
+
   // register a device with an id
-  void register_device(word device_id, std::unique_ptr<device> dev) { devices_[device_id] = std::move(dev); }
+  void register_device(word device_id, std::unique_ptr<device> dev) {
+    if (device_id >= max_devices) {
+      throw std::out_of_range("device id out of range");
+    }
+    devices_[device_id] = std::move(dev);
+  }
 
   // handle device access
   word access_device(word device_id, word command, word argument) {
-    auto it = devices_.find(device_id);
-    if (it != devices_.end()) {
-      return it->second->handle_command(device_id, command, argument);
+    if (device_id >= max_devices || !devices_[device_id]) {
+      return 0; // device not found
     }
-    return 0; // device not found
+    return devices_[device_id]->handle_command(device_id, command, argument);
   }
 
   // check if device exists
-  bool has_device(word device_id) const { return devices_.find(device_id) != devices_.end(); }
+  bool has_device(word device_id) const { return device_id < max_devices && devices_[device_id] != nullptr; }
 
   // get device by id (for testing/debugging)
-  device* get_device(word device_id) {
-    auto it = devices_.find(device_id);
-    return (it != devices_.end()) ? it->second.get() : nullptr;
-  }
+  device* get_device(word device_id) { return device_id < max_devices ? devices_[device_id].get() : nullptr; }
 
   // reset all devices
   void reset_all() {
-    for (auto& [id, dev] : devices_) {
-      dev->reset();
+    for (auto& dev : devices_) {
+      if (dev) {
+        dev->reset();
+      }
     }
   }
 
   // clear all devices
-  void clear() { devices_.clear(); }
+  void clear() {
+    for (auto& dev : devices_) {
+      dev.reset();
+    }
+  }
 
 private:
-  std::unordered_map<word, std::unique_ptr<device>> devices_;
+  std::array<std::unique_ptr<device>, max_devices> devices_;
 };
 
 // standard device ids (conventions)
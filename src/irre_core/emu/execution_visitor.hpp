@@ -5,13 +5,16 @@
 #include "memory.hpp"
 #include "state.hpp"
 #include "observer.hpp"
+#include <array>
 #include <variant>
 #include <vector>
 #include <memory>
 
 namespace irre::emu {
 
-// visitor class that executes irre instructions
+// executes irre instructions via a 256-entry jump table indexed by opcode:
+// one indirect call per instruction instead of variant dispatch followed by
+// a per-format compare chain
 class execution_visitor {
 public:
   execution_visitor(memory& mem, vm_state& state) : mem_(mem), state_(state) {}
@@ -19,346 +22,365 @@ public:
   // set observers for memory operation notifications
   void set_observers(const std::vector<std::shared_ptr<execution_observer>>* observers) { observers_ = observers; }
 
-  // main visitor entry point
-  void operator()(const instruction& inst) { std::visit(*this, inst); }
+  // main entry point
+  void operator()(const instruction& inst) { execute(get_opcode(inst), inst); }
 
-  // no-argument instructions
-  void operator()(const inst_op& inst) {
-    switch (inst.op) {
-    case opcode::nop:
-      // do nothing
-      break;
+  // dispatch with the opcode already in hand (e.g. from the vm's decode
+  // cache), skipping the variant index load
+  void execute(opcode op, const instruction& inst) {
+    handler h = k_dispatch[static_cast<size_t>(op)];
+    if (h == nullptr) {
+      state_.error(runtime_error::invalid_instruction);
+      return;
+    }
+    h(*this, inst);
+  }
 
-    case opcode::ret:
-      // return: pc = lr; lr = 0
-      state_.registers.set_pc(state_.registers.lr());
-      state_.registers.set_lr(0);
-      break;
+private:
+  using handler = void (*)(execution_visitor&, const instruction&);
 
-    case opcode::hlt:
-      state_.set_state(execution_state::halted);
-      break;
+  // --- no-argument instructions ---
 
-    default:
-      state_.error(runtime_error::invalid_instruction);
-    }
+  static void exec_nop(execution_visitor&, const instruction&) {
+    // do nothing
   }
 
-  // single register instructions
-  void operator()(const inst_op_reg& inst) {
-    switch (inst.op) {
-    case opcode::jmp:
-      // jump to address in register
-      state_.registers.set_pc(state_.registers.read(inst.a));
-      break;
+  static void exec_ret(execution_visitor& v, const instruction&) {
+    // return: pc = lr; lr = 0
+    v.state_.registers.set_pc(v.state_.registers.lr());
+    v.state_.registers.set_lr(0);
+  }
 
-    case opcode::cal:
-      // call: lr = pc + 4; pc = rA
-      state_.registers.set_lr(state_.registers.pc() + 4);
-      state_.registers.set_pc(state_.registers.read(inst.a));
-      break;
+  static void exec_hlt(execution_visitor& v, const instruction&) { v.state_.set_state(execution_state::halted); }
 
-    default:
-      state_.error(runtime_error::invalid_instruction);
-    }
+  // --- single register instructions ---
+
+  static void exec_jmp(execution_visitor& v, const instruction& inst) {
+    // jump to address in register
+    const auto& i = std::get<inst_op_reg>(inst);
+    v.state_.registers.set_pc(v.state_.registers.read(i.a));
   }
 
-  // 24-bit immediate instructions
-  void operator()(const inst_op_imm24& inst) {
-    switch (inst.op) {
-    case opcode::jmi:
-      // jump immediate
-      state_.registers.set_pc(inst.addr);
-      break;
+  static void exec_cal(execution_visitor& v, const instruction& inst) {
+    // call: lr = pc + 4; pc = rA
+    const auto& i = std::get<inst_op_reg>(inst);
+    v.state_.registers.set_lr(v.state_.registers.pc() + 4);
+    v.state_.registers.set_pc(v.state_.registers.read(i.a));
+  }
 
-    case opcode::int_:
-      // interrupt with code
-      state_.interrupt(inst.addr);
-      break;
+  // --- 24-bit immediate instructions ---
 
-    default:
-      state_.error(runtime_error::invalid_instruction);
+  static void exec_jmi(execution_visitor& v, const instruction& inst) {
+    // jump immediate
+    v.state_.registers.set_pc(std::get<inst_op_imm24>(inst).addr);
+  }
+
+  static void exec_int(execution_visitor& v, const instruction& inst) {
+    // interrupt with code
+    v.state_.interrupt(std::get<inst_op_imm24>(inst).addr);
+  }
+
+  // --- register + 16-bit immediate instructions ---
+
+  static void exec_set(execution_visitor& v, const instruction& inst) {
+    // set register to immediate value
+    const auto& i = std::get<inst_op_reg_imm16>(inst);
+    v.state_.registers.write(i.a, i.imm);
+  }
+
+  static void exec_sup(execution_visitor& v, const instruction& inst) {
+    // set upper 16 bits: rA = (rA & 0xFFFF) | (imm << 16)
+    const auto& i = std::get<inst_op_reg_imm16>(inst);
+    word current = v.state_.registers.read(i.a);
+    word new_value = (current & 0xFFFF) | (static_cast<word>(i.imm) << 16);
+    v.state_.registers.write(i.a, new_value);
+  }
+
+  // --- two register instructions ---
+
+  static void exec_mov(execution_visitor& v, const instruction& inst) {
+    // move register: rA = rB
+    const auto& i = std::get<inst_op_reg_reg>(inst);
+    v.state_.registers.write(i.a, v.state_.registers.read(i.b));
+  }
+
+  static void exec_not(execution_visitor& v, const instruction& inst) {
+    // bitwise not: rA = ~rB
+    const auto& i = std::get<inst_op_reg_reg>(inst);
+    v.state_.registers.write(i.a, ~v.state_.registers.read(i.b));
+  }
+
+  static void exec_sxt(execution_visitor& v, const instruction& inst) {
+    // sign extend: rA = sign_extend(rB)
+    const auto& i = std::get<inst_op_reg_reg>(inst);
+    word value = v.state_.registers.read(i.b);
+    // assume we're sign extending from 16 bits for now
+    if (value & 0x8000) {
+      value |= 0xFFFF0000; // extend sign bit
+    } else {
+      value &= 0x0000FFFF; // clear upper bits
     }
+    v.state_.registers.write(i.a, value);
   }
 
-  // register + 16-bit immediate instructions
-  void operator()(const inst_op_reg_imm16& inst) {
-    switch (inst.op) {
-    case opcode::set:
-      // set register to immediate value
-      state_.registers.write(inst.a, inst.imm);
-      break;
-
-    case opcode::sup:
-      // set upper 16 bits: rA = (rA & 0xFFFF) | (imm << 16)
-      {
-        word current = state_.registers.read(inst.a);
-        word new_value = (current & 0xFFFF) | (static_cast<word>(inst.imm) << 16);
-        state_.registers.write(inst.a, new_value);
-      }
-      break;
+  // --- two registers + 8-bit immediate instructions ---
+
+  static void exec_ldw(execution_visitor& v, const instruction& inst) {
+    // load word: rA = memory[rB + offset]
+    const auto& i = std::get<inst_op_reg_reg_imm8>(inst);
+    address addr = v.state_.registers.read(i.b) + static_cast<signed_word>(static_cast<int8_t>(i.offset));
+    try {
+      word value = v.mem_.read_word(addr);
+      v.notify_memory_read(addr, value);
+      v.state_.registers.write(i.a, value);
+    } catch (const std::out_of_range&) {
+      v.state_.error(runtime_error::invalid_memory_access);
+    }
+  }
 
-    default:
-      state_.error(runtime_error::invalid_instruction);
+  static void exec_stw(execution_visitor& v, const instruction& inst) {
+    // store word: memory[rB + offset] = rA
+    const auto& i = std::get<inst_op_reg_reg_imm8>(inst);
+    address addr = v.state_.registers.read(i.b) + static_cast<signed_word>(static_cast<int8_t>(i.offset));
+    word value = v.state_.registers.read(i.a);
+    try {
+      v.mem_.write_word(addr, value);
+      v.notify_memory_write(addr, value);
+    } catch (const std::out_of_range&) {
+      v.state_.error(runtime_error::invalid_memory_access);
     }
   }
 
-  // two register instructions
-  void operator()(const inst_op_reg_reg& inst) {
-    switch (inst.op) {
-    case opcode::mov:
-      // move register: rA = rB
-      state_.registers.write(inst.a, state_.registers.read(inst.b));
-      break;
-
-    case opcode::not_:
-      // bitwise not: rA = ~rB
-      state_.registers.write(inst.a, ~state_.registers.read(inst.b));
-      break;
-
-    case opcode::sxt:
-      // sign extend: rA = sign_extend(rB)
-      {
-        word value = state_.registers.read(inst.b);
-        // assume we're sign extending from 16 bits for now
-        if (value & 0x8000) {
-          value |= 0xFFFF0000; // extend sign bit
-        } else {
-          value &= 0x0000FFFF; // clear upper bits
-        }
-        state_.registers.write(inst.a, value);
-      }
-      break;
+  static void exec_ldb(execution_visitor& v, const instruction& inst) {
+    // load byte: rA = memory[rB + offset] (zero-extended)
+    const auto& i = std::get<inst_op_reg_reg_imm8>(inst);
+    address addr = v.state_.registers.read(i.b) + static_cast<signed_word>(static_cast<int8_t>(i.offset));
+    try {
+      byte byte_value = v.mem_.read_byte(addr);
+      word value = static_cast<word>(byte_value);
+      v.notify_memory_read(addr, value);
+      v.state_.registers.write(i.a, value);
+    } catch (const std::out_of_range&) {
+      v.state_.error(runtime_error::invalid_memory_access);
+    }
+  }
 
-    default:
-      state_.error(runtime_error::invalid_instruction);
+  static void exec_stb(execution_visitor& v, const instruction& inst) {
+    // store byte: memory[rB + offset] = rA (lower 8 bits)
+    const auto& i = std::get<inst_op_reg_reg_imm8>(inst);
+    address addr = v.state_.registers.read(i.b) + static_cast<signed_word>(static_cast<int8_t>(i.offset));
+    word reg_value = v.state_.registers.read(i.a);
+    byte byte_value = static_cast<byte>(reg_value & 0xFF);
+    try {
+      v.mem_.write_byte(addr, byte_value);
+      v.notify_memory_write(addr, static_cast<word>(byte_value));
+    } catch (const std::out_of_range&) {
+      v.state_.error(runtime_error::invalid_memory_access);
     }
   }
 
-  // two registers + 8-bit immediate instructions
-  void operator()(const inst_op_reg_reg_imm8& inst) {
-    switch (inst.op) {
-    case opcode::ldw:
-      // load word: rA = memory[rB + offset]
-      {
-        address addr = state_.registers.read(inst.b) + static_cast<signed_word>(static_cast<int8_t>(inst.offset));
-        try {
-          word value = mem_.read_word(addr);
-          notify_memory_read(addr, value);
-          state_.registers.write(inst.a, value);
-        } catch (const std::out_of_range&) {
-          state_.error(runtime_error::invalid_memory_access);
-        }
-      }
-      break;
-
-    case opcode::stw:
-      // store word: memory[rB + offset] = rA
-      {
-        address addr = state_.registers.read(inst.b) + static_cast<signed_word>(static_cast<int8_t>(inst.offset));
-        word value = state_.registers.read(inst.a);
-        try {
-          mem_.write_word(addr, value);
-          notify_memory_write(addr, value);
-        } catch (const std::out_of_range&) {
-          state_.error(runtime_error::invalid_memory_access);
-        }
-      }
-      break;
-
-    case opcode::ldb:
-      // load byte: rA = memory[rB + offset] (zero-extended)
-      {
-        address addr = state_.registers.read(inst.b) + static_cast<signed_word>(static_cast<int8_t>(inst.offset));
-        try {
-          byte byte_value = mem_.read_byte(addr);
-          word value = static_cast<word>(byte_value);
-          notify_memory_read(addr, value);
-          state_.registers.write(inst.a, value);
-        } catch (const std::out_of_range&) {
-          state_.error(runtime_error::invalid_memory_access);
-        }
-      }
-      break;
-
-    case opcode::stb:
-      // store byte: memory[rB + offset] = rA (lower 8 bits)
-      {
-        address addr = state_.registers.read(inst.b) + static_cast<signed_word>(static_cast<int8_t>(inst.offset));
-        word reg_value = state_.registers.read(inst.a);
-        byte byte_value = static_cast<byte>(reg_value & 0xFF);
-        try {
-          mem_.write_byte(addr, byte_value);
-          notify_memory_write(addr, static_cast<word>(byte_value));
-        } catch (const std::out_of_range&) {
-          state_.error(runtime_error::invalid_memory_access);
-        }
-      }
-      break;
+  static void exec_bve(execution_visitor& v, const instruction& inst) {
+    // branch if equal: if rB == offset then pc = rA
+    const auto& i = std::get<inst_op_reg_reg_imm8>(inst);
+    if (v.state_.registers.read(i.b) == i.offset) {
+      v.state_.registers.set_pc(v.state_.registers.read(i.a));
+    }
+  }
 
-    case opcode::bve:
-      // branch if equal: if rB == offset then pc = rA
-      if (state_.registers.read(inst.b) == inst.offset) {
-        state_.registers.set_pc(state_.registers.read(inst.a));
-      }
-      break;
+  static void exec_bvn(execution_visitor& v, const instruction& inst) {
+    // branch if not equal: if rB != offset then pc = rA
+    const auto& i = std::get<inst_op_reg_reg_imm8>(inst);
+    if (v.state_.registers.read(i.b) != i.offset) {
+      v.state_.registers.set_pc(v.state_.registers.read(i.a));
+    }
+  }
 
-    case opcode::bvn:
-      // branch if not equal: if rB != offset then pc = rA
-      if (state_.registers.read(inst.b) != inst.offset) {
-        state_.registers.set_pc(state_.registers.read(inst.a));
-      }
-      break;
+  static void exec_seq(execution_visitor& v, const instruction& inst) {
+    // set if equal: rA = (rB == offset) ? 1 : 0
+    const auto& i = std::get<inst_op_reg_reg_imm8>(inst);
+    v.state_.registers.write(i.a, (v.state_.registers.read(i.b) == i.offset) ? 1 : 0);
+  }
 
-    case opcode::seq:
-      // set if equal: rA = (rB == offset) ? 1 : 0
-      state_.registers.write(inst.a, (state_.registers.read(inst.b) == inst.offset) ? 1 : 0);
-      break;
+  // --- register + two 8-bit immediate instructions ---
 
-    default:
-      state_.error(runtime_error::invalid_instruction);
-    }
+  static void exec_sia(execution_visitor& v, const instruction& inst) {
+    // shift and add: rA = rA + (v0 << v1)
+    const auto& i = std::get<inst_op_reg_imm8x2>(inst);
+    word current = v.state_.registers.read(i.a);
+    word shifted = static_cast<word>(i.v0) << i.v1;
+    v.state_.registers.write(i.a, current + shifted);
   }
 
-  // register + two 8-bit immediate instructions
-  void operator()(const inst_op_reg_imm8x2& inst) {
-    switch (inst.op) {
-    case opcode::sia:
-      // shift and add: rA = rA + (v0 << v1)
-      {
-        word current = state_.registers.read(inst.a);
-        word shifted = static_cast<word>(inst.v0) << inst.v1;
-        state_.registers.write(inst.a, current + shifted);
-      }
-      break;
+  // --- three register instructions ---
 
-    default:
-      state_.error(runtime_error::invalid_instruction);
+  static void exec_add(execution_visitor& v, const instruction& inst) {
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    v.state_.registers.write(i.a, v.state_.registers.read(i.b) + v.state_.registers.read(i.c));
+  }
+
+  static void exec_sub(execution_visitor& v, const instruction& inst) {
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    v.state_.registers.write(i.a, v.state_.registers.read(i.b) - v.state_.registers.read(i.c));
+  }
+
+  static void exec_mul(execution_visitor& v, const instruction& inst) {
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    v.state_.registers.write(i.a, v.state_.registers.read(i.b) * v.state_.registers.read(i.c));
+  }
+
+  static void exec_div(execution_visitor& v, const instruction& inst) {
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    word b_val = v.state_.registers.read(i.b);
+    word c_val = v.state_.registers.read(i.c);
+    // divide by a forced-non-zero divisor so the division never depends on
+    // the guard; the zero test below is then a single well-predicted branch
+    // on the error path only (real programs almost never divide by zero)
+    word quotient = b_val / (c_val | static_cast<word>(c_val == 0));
+    if (c_val == 0) {
+      v.state_.error(runtime_error::division_by_zero);
+      return;
     }
+    v.state_.registers.write(i.a, quotient);
   }
 
-  // three register instructions
-  void operator()(const inst_op_reg_reg_reg& inst) {
-    word b_val = state_.registers.read(inst.b);
-    word c_val = state_.registers.read(inst.c);
+  static void exec_mod(execution_visitor& v, const instruction& inst) {
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    word b_val = v.state_.registers.read(i.b);
+    word c_val = v.state_.registers.read(i.c);
+    // same forced-non-zero divisor trick as exec_div
+    word remainder = b_val % (c_val | static_cast<word>(c_val == 0));
+    if (c_val == 0) {
+      v.state_.error(runtime_error::division_by_zero);
+      return;
+    }
+    v.state_.registers.write(i.a, remainder);
+  }
 
-    switch (inst.op) {
-    case opcode::add:
-      state_.registers.write(inst.a, b_val + c_val);
-      break;
+  static void exec_and(execution_visitor& v, const instruction& inst) {
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    v.state_.registers.write(i.a, v.state_.registers.read(i.b) & v.state_.registers.read(i.c));
+  }
 
-    case opcode::sub:
-      state_.registers.write(inst.a, b_val - c_val);
-      break;
+  static void exec_orr(execution_visitor& v, const instruction& inst) {
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    v.state_.registers.write(i.a, v.state_.registers.read(i.b) | v.state_.registers.read(i.c));
+  }
 
-    case opcode::mul:
-      state_.registers.write(inst.a, b_val * c_val);
-      break;
+  static void exec_xor(execution_visitor& v, const instruction& inst) {
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    v.state_.registers.write(i.a, v.state_.registers.read(i.b) ^ v.state_.registers.read(i.c));
+  }
 
-    case opcode::div:
-      if (c_val == 0) {
-        state_.error(runtime_error::division_by_zero);
-      } else {
-        state_.registers.write(inst.a, b_val / c_val);
-      }
-      break;
+  static void exec_lsh(execution_visitor& v, const instruction& inst) {
+    // logical shift: positive = left, negative = right
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    word b_val = v.state_.registers.read(i.b);
+    signed_word shift = static_cast<signed_word>(v.state_.registers.read(i.c));
+    if (shift < -32 || shift > 32) {
+      v.state_.error(runtime_error::invalid_instruction);
+      return;
+    }
+    if (shift >= 0) {
+      v.state_.registers.write(i.a, b_val << shift);
+    } else {
+      v.state_.registers.write(i.a, b_val >> (-shift));
+    }
+  }
 
-    case opcode::mod:
-      if (c_val == 0) {
-        state_.error(runtime_error::division_by_zero);
-      } else {
-        state_.registers.write(inst.a, b_val % c_val);
-      }
-      break;
-
-    case opcode::and_:
-      state_.registers.write(inst.a, b_val & c_val);
-      break;
-
-    case opcode::orr:
-      state_.registers.write(inst.a, b_val | c_val);
-      break;
-
-    case opcode::xor_:
-      state_.registers.write(inst.a, b_val ^ c_val);
-      break;
-
-    case opcode::lsh:
-      // logical shift: positive = left, negative = right
-      {
-        signed_word shift = static_cast<signed_word>(c_val);
-        if (shift < -32 || shift > 32) {
-          state_.error(runtime_error::invalid_instruction);
-          break;
-        }
-        if (shift >= 0) {
-          state_.registers.write(inst.a, b_val << shift);
-        } else {
-          state_.registers.write(inst.a, b_val >> (-shift));
-        }
-      }
-      break;
-
-    case opcode::ash:
-      // arithmetic shift: preserves sign on right shift
-      {
-        signed_word shift = static_cast<signed_word>(c_val);
-        if (shift < -32 || shift > 32) {
-          state_.error(runtime_error::invalid_instruction);
-          break;
-        }
-        signed_word signed_b = static_cast<signed_word>(b_val);
-        if (shift >= 0) {
-          state_.registers.write(inst.a, static_cast<word>(signed_b << shift));
-        } else {
-          state_.registers.write(inst.a, static_cast<word>(signed_b >> (-shift)));
-        }
-      }
-      break;
-
-    case opcode::tcu:
-      // test compare unsigned: result = sign(b - c)
-      if (b_val < c_val) {
-        state_.registers.write(inst.a, static_cast<word>(-1));
-      } else if (b_val > c_val) {
-        state_.registers.write(inst.a, 1);
-      } else {
-        state_.registers.write(inst.a, 0);
-      }
-      break;
-
-    case opcode::tcs:
-      // test compare signed: result = sign(b - c)
-      {
-        signed_word signed_b = static_cast<signed_word>(b_val);
-        signed_word signed_c = static_cast<signed_word>(c_val);
-        if (signed_b < signed_c) {
-          state_.registers.write(inst.a, static_cast<word>(-1));
-        } else if (signed_b > signed_c) {
-          state_.registers.write(inst.a, 1);
-        } else {
-          state_.registers.write(inst.a, 0);
-        }
-      }
-      break;
-
-    case opcode::snd:
-      // send to device: send command rB to device rA with argument rC; result in rC
-      {
-        word device_id = state_.registers.read(inst.a);
-        word command = state_.registers.read(inst.b);
-        word argument = state_.registers.read(inst.c);
-        word result = state_.device_access(device_id, command, argument);
-        state_.registers.write(inst.c, result);
-      }
-      break;
+  static void exec_ash(execution_visitor& v, const instruction& inst) {
+    // arithmetic shift: preserves sign on right shift
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    signed_word signed_b = static_cast<signed_word>(v.state_.registers.read(i.b));
+    signed_word shift = static_cast<signed_word>(v.state_.registers.read(i.c));
+    if (shift < -32 || shift > 32) {
+      v.state_.error(runtime_error::invalid_instruction);
+      return;
+    }
+    if (shift >= 0) {
+      v.state_.registers.write(i.a, static_cast<word>(signed_b << shift));
+    } else {
+      v.state_.registers.write(i.a, static_cast<word>(signed_b >> (-shift)));
+    }
+  }
 
-    default:
-      state_.error(runtime_error::invalid_instruction);
+  static void exec_tcu(execution_visitor& v, const instruction& inst) {
+    // test compare unsigned: result = sign(b - c)
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    word b_val = v.state_.registers.read(i.b);
+    word c_val = v.state_.registers.read(i.c);
+    if (b_val < c_val) {
+      v.state_.registers.write(i.a, static_cast<word>(-1));
+    } else if (b_val > c_val) {
+      v.state_.registers.write(i.a, 1);
+    } else {
+      v.state_.registers.write(i.a, 0);
     }
   }
 
-private:
+  static void exec_tcs(execution_visitor& v, const instruction& inst) {
+    // test compare signed: result = sign(b - c)
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    signed_word signed_b = static_cast<signed_word>(v.state_.registers.read(i.b));
+    signed_word signed_c = static_cast<signed_word>(v.state_.registers.read(i.c));
+    if (signed_b < signed_c) {
+      v.state_.registers.write(i.a, static_cast<word>(-1));
+    } else if (signed_b > signed_c) {
+      v.state_.registers.write(i.a, 1);
+    } else {
+      v.state_.registers.write(i.a, 0);
+    }
+  }
+
+  static void exec_snd(execution_visitor& v, const instruction& inst) {
+    // send to device: send command rB to device rA with argument rC; result in rC
+    const auto& i = std::get<inst_op_reg_reg_reg>(inst);
+    word device_id = v.state_.registers.read(i.a);
+    word command = v.state_.registers.read(i.b);
+    word argument = v.state_.registers.read(i.c);
+    word result = v.state_.device_access(device_id, command, argument);
+    v.state_.registers.write(i.c, result);
+  }
+
+  // opcode byte -> handler; unassigned entries stay null and report
+  // invalid_instruction at dispatch
+  static constexpr auto k_dispatch = [] {
+    std::array<handler, 256> t{};
+    t[static_cast<size_t>(opcode::nop)] = exec_nop;
+    t[static_cast<size_t>(opcode::add)] = exec_add;
+    t[static_cast<size_t>(opcode::sub)] = exec_sub;
+    t[static_cast<size_t>(opcode::and_)] = exec_and;
+    t[static_cast<size_t>(opcode::orr)] = exec_orr;
+    t[static_cast<size_t>(opcode::xor_)] = exec_xor;
+    t[static_cast<size_t>(opcode::not_)] = exec_not;
+    t[static_cast<size_t>(opcode::lsh)] = exec_lsh;
+    t[static_cast<size_t>(opcode::ash)] = exec_ash;
+    t[static_cast<size_t>(opcode::tcu)] = exec_tcu;
+    t[static_cast<size_t>(opcode::tcs)] = exec_tcs;
+    t[static_cast<size_t>(opcode::set)] = exec_set;
+    t[static_cast<size_t>(opcode::mov)] = exec_mov;
+    t[static_cast<size_t>(opcode::ldw)] = exec_ldw;
+    t[static_cast<size_t>(opcode::stw)] = exec_stw;
+    t[static_cast<size_t>(opcode::ldb)] = exec_ldb;
+    t[static_cast<size_t>(opcode::stb)] = exec_stb;
+    t[static_cast<size_t>(opcode::jmi)] = exec_jmi;
+    t[static_cast<size_t>(opcode::jmp)] = exec_jmp;
+    t[static_cast<size_t>(opcode::bve)] = exec_bve;
+    t[static_cast<size_t>(opcode::bvn)] = exec_bvn;
+    t[static_cast<size_t>(opcode::cal)] = exec_cal;
+    t[static_cast<size_t>(opcode::ret)] = exec_ret;
+    t[static_cast<size_t>(opcode::mul)] = exec_mul;
+    t[static_cast<size_t>(opcode::div)] = exec_div;
+    t[static_cast<size_t>(opcode::mod)] = exec_mod;
+    t[static_cast<size_t>(opcode::sia)] = exec_sia;
+    t[static_cast<size_t>(opcode::sup)] = exec_sup;
+    t[static_cast<size_t>(opcode::sxt)] = exec_sxt;
+    t[static_cast<size_t>(opcode::seq)] = exec_seq;
+    t[static_cast<size_t>(opcode::int_)] = exec_int;
+    t[static_cast<size_t>(opcode::snd)] = exec_snd;
+    t[static_cast<size_t>(opcode::hlt)] = exec_hlt;
+    return t;
+  }();
+
   memory& mem_;
   vm_state& state_;
   const std::vector<std::shared_ptr<execution_observer>>* observers_ = nullptr;
@@ -381,4 +403,4 @@ private:
   }
 };
 
-} // namespace irre::emu
\ No newline at end of file
+} // namespace irre::emu
@@ -21,9 +21,11 @@ public:
       throw std::out_of_range("memory access out of bounds");
     }
 
-    // little-endian: lsb at lowest address
-    return static_cast<word>(data_[addr]) | (static_cast<word>(data_[addr + 1]) << 8) |
-           (static_cast<word>(data_[addr + 2]) << 16) | (static_cast<word>(data_[addr + 3]) << 24);
+    // little-endian memory matches host byte order on our supported targets,
+    // so this is one bounds check and one 32-bit load
+    word value;
+    std::memcpy(&value, &data_[addr], 4);
+    return value;
   }
 
   // write word (32-bit) to memory with little-endian conversion
@@ -32,11 +34,8 @@ public:
       throw std::out_of_range("memory access out of bounds");
     }
 
-    // little-endian: lsb at lowest address
-    data_[addr] = static_cast<byte>(value & 0xff);
-    data_[addr + 1] = static_cast<byte>((value >> 8) & 0xff);
-    data_[addr + 2] = static_cast<byte>((value >> 16) & 0xff);
-    data_[addr + 3] = static_cast<byte>((value >> 24) & 0xff);
+    // little-endian: lsb at lowest address; single 32-bit store
+    std::memcpy(&data_[addr], &value, 4);
   }
 
   // read byte from memory
@@ -90,6 +89,13 @@ public:
   // clear all memory
   void clear() { std::fill(data_.begin(), data_.end(), 0); }
 
+  // clear memory from addr to the end
+  void clear_from(address addr) {
+    if (addr < data_.size()) {
+      std::memset(&data_[addr], 0, data_.size() - addr);
+    }
+  }
+
   // check if address range is valid
   bool is_valid_range(address addr, size_t size) const { return addr + size <= data_.size(); }
 
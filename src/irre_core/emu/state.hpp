@@ -3,6 +3,7 @@
 #include "../arch/types.hpp"
 #include "../arch/instruction.hpp"
 #include <array>
+#include <cstring>
 #include <functional>
 
 namespace irre::emu {
@@ -77,8 +78,9 @@ public:
   word at() const { return read(reg::at); }
   void set_at(word value) { write(reg::at, value); }
 
-  // clear all registers to zero
-  void clear() { registers_.fill(0); }
+  // clear all registers to zero; the file is one flat word array, so this is
+  // a single memset the compiler turns into a few wide stores
+  void clear() noexcept { std::memset(registers_.data(), 0, sizeof(registers_)); }
 
   // get raw register array for debugging
   const std::array<word, 37>& raw() const { return registers_; }
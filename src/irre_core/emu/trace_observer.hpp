@@ -25,7 +25,7 @@ public:
     // always print basic trace
     std::cout << "0x" << std::hex << std::setfill('0') << std::setw(8) 
               << ctx.pc << ": 0x" << std::setw(8) << ctx.raw_instruction 
-              << " " << std::dec << format_instruction(ctx.inst);
+              << " " << std::dec << format_instruction(ctx.inst).view();
     
     if (verbosity_ == verbosity::semantic) {
       // capture pre-execution values
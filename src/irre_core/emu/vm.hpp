@@ -7,6 +7,7 @@
 #include "state.hpp"
 #include "execution_visitor.hpp"
 #include "observer.hpp"
+#include <algorithm>
 #include <functional>
 #include <vector>
 #include <memory>
@@ -28,9 +29,6 @@ public:
 
   // load program from object file
   void load_program(const assembler::object_file& obj) {
-    // clear memory first
-    memory_.clear();
-
     address current_address = 0;
 
     // load code section at address 0
@@ -42,8 +40,13 @@ public:
     // load data section immediately after code
     if (!obj.data.empty()) {
       memory_.load_data(current_address, obj.data);
+      current_address += static_cast<address>(obj.data.size());
     }
 
+    // zero only the residual tail: each program byte is written exactly once
+    // instead of being cleared and then overwritten
+    memory_.clear_from(current_address);
+
     // set entry point
     state_.registers.set_pc(obj.entry_offset);
 
@@ -53,16 +56,23 @@ public:
     // set state to running
     state_.set_state(execution_state::running);
     state_.reset_stats();
+    reset_icache();
   }
 
-  // load raw binary data
-  void load_binary(const std::vector<byte>& data, address start_addr = 0) {
+  // load raw binary data straight from a caller buffer (no intermediate copy)
+  void load_binary(const byte* data, size_t size, address start_addr = 0) {
     memory_.clear();
-    memory_.load_data(start_addr, data);
+    memory_.load_data(start_addr, data, size);
     state_.registers.set_pc(start_addr);
     state_.registers.set_sp(static_cast<word>(memory_.size() - 4));
     state_.set_state(execution_state::running);
     state_.reset_stats();
+    reset_icache();
+  }
+
+  // load raw binary data
+  void load_binary(const std::vector<byte>& data, address start_addr = 0) {
+    load_binary(data.data(), data.size(), start_addr);
   }
 
   // single step execution
@@ -86,24 +96,41 @@ public:
       return false;
     }
 
-    word instruction_word = memory_.read_word(pc);
+    // fetch from the decode cache; tight loops re-execute the same words, so
+    // each one is decoded once and reused until something stores over it.
+    // opcodes live in their own byte array, so the dispatch load touches one
+    // byte per instruction and a cache line covers 64 upcoming slots
+    size_t idx = pc >> 2;
+    uint8_t op_byte = icache_op_[idx];
+    if (op_byte == k_icache_empty) {
+      word instruction_word = memory_.read_word(pc);
+
+      // decode instruction
+      auto decode_result = codec::decode(instruction_word);
+      if (decode_result.is_err()) {
+        // Format detailed error message for invalid instruction
+        char msg[128];
+        std::snprintf(msg, sizeof(msg), "invalid instruction: 0x%08x (%02x %02x %02x %02x)", 
+                     instruction_word,
+                     static_cast<uint8_t>(instruction_word & 0xFF),
+                     static_cast<uint8_t>((instruction_word >> 8) & 0xFF),
+                     static_cast<uint8_t>((instruction_word >> 16) & 0xFF),
+                     static_cast<uint8_t>((instruction_word >> 24) & 0xFF));
+        state_.error(error_info(runtime_error::invalid_instruction, pc, instruction_word, msg));
+        return false;
+      }
 
-    // decode instruction
-    auto decode_result = codec::decode(instruction_word);
-    if (decode_result.is_err()) {
-      // Format detailed error message for invalid instruction
-      char msg[128];
-      std::snprintf(msg, sizeof(msg), "invalid instruction: 0x%08x (%02x %02x %02x %02x)", 
-                   instruction_word,
-                   static_cast<uint8_t>(instruction_word & 0xFF),
-                   static_cast<uint8_t>((instruction_word >> 8) & 0xFF),
-                   static_cast<uint8_t>((instruction_word >> 16) & 0xFF),
-                   static_cast<uint8_t>((instruction_word >> 24) & 0xFF));
-      state_.error(error_info(runtime_error::invalid_instruction, pc, instruction_word, msg));
-      return false;
+      icache_inst_[idx] = decode_result.value();
+      op_byte = static_cast<uint8_t>((instruction_word >> 24) & 0xff);
+      icache_op_[idx] = op_byte;
     }
 
-    instruction inst = decode_result.value();
+    if (idx + 16 < icache_op_.size()) {
+      __builtin_prefetch(&icache_op_[idx + 16]);
+    }
+
+    word instruction_word = memory_.read_word(pc);
+    instruction inst = icache_inst_[idx];
 
     // notify observers before execution
     execution_observer::execution_context ctx{pc, instruction_word, inst, state_.registers, memory_};
@@ -114,15 +141,31 @@ public:
     // save pc for potential branching logic
     address next_pc = pc + 4;
 
+    // capture a store's effective address before execution: the base register
+    // can be pc, whose value changes once the pc advances below, so a
+    // recomputation afterwards would invalidate the wrong slot
+    opcode op = static_cast<opcode>(op_byte);
+    bool is_store = op == opcode::stw || op == opcode::stb;
+    address store_addr = 0;
+    if (is_store) {
+      const auto& i = std::get<inst_op_reg_reg_imm8>(inst);
+      store_addr = state_.registers.read(i.b) + static_cast<signed_word>(static_cast<int8_t>(i.offset));
+    }
+
     // set observers for visitor and execute instruction
     visitor_.set_observers(&observers_);
-    visitor_(inst);
+    visitor_.execute(op, inst);
 
     // if execution didn't change pc (no jumps/branches), advance normally
     if (state_.registers.pc() == pc && state_.is_running()) {
       state_.registers.set_pc(next_pc);
     }
 
+    // keep the decode cache coherent with stores into code
+    if (is_store) {
+      invalidate_icache(store_addr, op == opcode::stw ? 4 : 1);
+    }
+
     // notify observers after execution
     for (auto& observer : observers_) {
       observer->post_execute(ctx);
@@ -136,10 +179,21 @@ public:
 
   // run until halt or error
   void run(size_t max_instructions = 0) {
-    size_t count = 0;
-    while (step()) {
-      if (max_instructions > 0 && ++count >= max_instructions) {
-        break;
+    // uncapped: no budget bookkeeping at all in the loop
+    if (max_instructions == 0) {
+      while (step()) {
+      }
+      return;
+    }
+
+    // capped: execute in blocks so the budget math happens once per block
+    // instead of once per instruction
+    for (size_t done = 0; done < max_instructions; done += k_run_block) {
+      size_t batch = std::min(k_run_block, max_instructions - done);
+      for (size_t i = 0; i < batch; ++i) {
+        if (!step()) {
+          return;
+        }
       }
     }
   }
@@ -150,6 +204,7 @@ public:
     state_.set_state(execution_state::halted);
     state_.reset_stats();
     memory_.clear();
+    reset_icache();
   }
 
   // device and system handlers
@@ -183,14 +238,49 @@ public:
   word read_memory_word(address addr) const { return memory_.read_word(addr); }
   byte read_memory_byte(address addr) const { return memory_.read_byte(addr); }
 
-  void write_memory_word(address addr, word value) { memory_.write_word(addr, value); }
-  void write_memory_byte(address addr, byte value) { memory_.write_byte(addr, value); }
+  void write_memory_word(address addr, word value) {
+    memory_.write_word(addr, value);
+    invalidate_icache(addr, 4);
+  }
+  void write_memory_byte(address addr, byte value) {
+    memory_.write_byte(addr, value);
+    invalidate_icache(addr, 1);
+  }
 
 private:
+  // instructions per block in the capped run loop
+  static constexpr size_t k_run_block = 64;
+
+  // sentinel opcode byte marking an undecoded cache slot; 0x11 is not a
+  // valid opcode, so no decoded entry can collide with it
+  static constexpr uint8_t k_icache_empty = 0x11;
+
+  // drop cache entries for the words touched by a write of `size` bytes
+  void invalidate_icache(address addr, size_t size) {
+    size_t first = addr >> 2;
+    size_t last = (addr + size - 1) >> 2;
+    for (size_t i = first; i <= last && i < icache_op_.size(); ++i) {
+      icache_op_[i] = k_icache_empty;
+    }
+  }
+
+  // clear the whole decode cache (program load / reset)
+  void reset_icache() {
+    icache_op_.assign(memory_.size() / 4, k_icache_empty);
+    icache_inst_.assign(memory_.size() / 4, instruction{});
+  }
+
   memory memory_;
   vm_state state_;
   execution_visitor visitor_;
   std::vector<std::shared_ptr<execution_observer>> observers_;
+
+  // lazily populated decode cache mirroring memory, split structure-of-arrays
+  // style: one opcode byte per word for dispatch and validity (k_icache_empty
+  // marks unfilled slots), with the operand payloads in a parallel array so
+  // opcode-only work never pulls payloads through the cache
+  std::vector<uint8_t> icache_op_;
+  std::vector<instruction> icache_inst_;
 };
 
 } // namespace irre::emu
\ No newline at end of file
@@ -4,4 +4,5 @@
 #include "util.hpp"
 #include "arch/instruction.hpp"
 #include "arch/encoding.hpp"
+#include "arch/stream.hpp"
 #include "arch/semantics.hpp"
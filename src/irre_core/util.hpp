@@ -16,19 +16,21 @@ private:
   std::variant<T, E> value_;
 
 public:
-  result(T value) : value_(std::move(value)) {}
-  result(E error) : value_(error) {}
+  // constexpr throughout so results over literal types (e.g. decoded
+  // instructions) can be produced and inspected at compile time
+  constexpr result(T value) : value_(std::move(value)) {}
+  constexpr result(E error) : value_(error) {}
 
-  bool is_ok() const { return std::holds_alternative<T>(value_); }
-  bool is_err() const { return std::holds_alternative<E>(value_); }
+  constexpr bool is_ok() const { return std::holds_alternative<T>(value_); }
+  constexpr bool is_err() const { return std::holds_alternative<E>(value_); }
 
-  const T& value() const { return std::get<T>(value_); }
-  T& value() { return std::get<T>(value_); }
+  constexpr const T& value() const { return std::get<T>(value_); }
+  constexpr T& value() { return std::get<T>(value_); }
 
-  const E& error() const { return std::get<E>(value_); }
+  constexpr const E& error() const { return std::get<E>(value_); }
 
   // unwrap with default
-  T value_or(T default_val) const { return is_ok() ? value() : std::move(default_val); }
+  constexpr T value_or(T default_val) const { return is_ok() ? value() : std::move(default_val); }
 
   // map operation
   template <typename F> auto map(F&& f) const -> result<decltype(f(value())), E> {
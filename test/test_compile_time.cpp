@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "irre.hpp"
+#include <string_view>
+
+using namespace irre;
+
+// opcode metadata is pure constexpr table lookup, so the checks run at compile
+// time: any divergence between opcode, mnemonic, and format fails the build
+// instead of a test run
+
+namespace {
+
+constexpr bool mnemonic_is(opcode op, std::string_view expected) { return get_mnemonic(op) == expected; }
+
+} // namespace
+
+// get_opcode_info ties mnemonic and format together
+static_assert(mnemonic_is(opcode::nop, "nop"));
+static_assert(get_opcode_info(opcode::nop).fmt == format::op);
+static_assert(mnemonic_is(opcode::add, "add"));
+static_assert(get_opcode_info(opcode::add).fmt == format::op_reg_reg_reg);
+static_assert(mnemonic_is(opcode::set, "set"));
+static_assert(get_opcode_info(opcode::set).fmt == format::op_reg_imm16);
+
+// get_format covers one opcode per instruction format
+static_assert(get_format(opcode::nop) == format::op);
+static_assert(get_format(opcode::jmp) == format::op_reg);
+static_assert(get_format(opcode::jmi) == format::op_imm24);
+static_assert(get_format(opcode::set) == format::op_reg_imm16);
+static_assert(get_format(opcode::mov) == format::op_reg_reg);
+static_assert(get_format(opcode::ldw) == format::op_reg_reg_imm8);
+static_assert(get_format(opcode::sia) == format::op_reg_imm8x2);
+static_assert(get_format(opcode::add) == format::op_reg_reg_reg);
+
+// get_mnemonic spot checks
+static_assert(mnemonic_is(opcode::sub, "sub"));
+static_assert(mnemonic_is(opcode::jmp, "jmp"));
+static_assert(mnemonic_is(opcode::hlt, "hlt"));
+
+TEST_CASE("Opcode metadata") {
+  // the real coverage is the static_asserts above; this keeps a runtime probe
+  // so the translation unit is linked and the tables exist at runtime too
+  REQUIRE(get_mnemonic(opcode::nop) == "nop");
+  REQUIRE(get_format(opcode::nop) == format::op);
+}
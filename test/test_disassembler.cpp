@@ -4,10 +4,29 @@
 #include "assembler/object.hpp"
 #include "arch/instruction.hpp"
 #include "arch/encoding.hpp"
+#include <array>
 #include <iostream>
+#include <functional>
+#include <initializer_list>
+#include <string_view>
+#include "test_helpers.hpp"
+#include <array>
 
 namespace asmr = irre::assembler;
 using irre::byte;
+using namespace std::string_view_literals;
+
+// check a batch of expected needles against one disassembly string, each with
+// a boyer-moore-horspool searcher instead of repeated naive find scans
+static bool contains_all(std::string_view haystack, std::initializer_list<std::string_view> needles) {
+  for (auto needle : needles) {
+    std::boyer_moore_horspool_searcher searcher(needle.begin(), needle.end());
+    if (std::search(haystack.begin(), haystack.end(), searcher) == haystack.end()) {
+      return false;
+    }
+  }
+  return true;
+}
 
 TEST_CASE("disassembler basic functionality", "[disassembler]") {
   asmr::disassembler disasm;
@@ -17,7 +36,7 @@ TEST_CASE("disassembler basic functionality", "[disassembler]") {
     auto result = disasm.disassemble_instruction(inst);
 
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "0x0000: 00000000  nop");
+    REQUIRE(std::string_view{result.value()} == "0x0000: 00000000  nop"sv);
   }
 
   SECTION("disassemble single instruction - no annotations") {
@@ -30,7 +49,7 @@ TEST_CASE("disassembler basic functionality", "[disassembler]") {
     auto result = disasm.disassemble_instruction(inst);
 
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "add r0 r1 r2");
+    REQUIRE(std::string_view{result.value()} == "add r0 r1 r2"sv);
   }
 
   SECTION("disassemble instruction with address") {
@@ -38,8 +57,7 @@ TEST_CASE("disassembler basic functionality", "[disassembler]") {
     auto result = disasm.disassemble_instruction(inst, 0x1000);
 
     REQUIRE(result.is_ok());
-    std::string expected = "0x1000: 2a00000b  set r0 0x002a";
-    REQUIRE(result.value() == expected);
+    REQUIRE(std::string_view{result.value()} == "0x1000: 2a00000b  set r0 0x002a"sv);
   }
 }
 
@@ -61,14 +79,18 @@ TEST_CASE("disassembler raw bytes", "[disassembler]") {
     std::string output = result.value();
 
     // check that it contains expected instructions
-    REQUIRE(output.find("nop") != std::string::npos);
-    REQUIRE(output.find("add r0 r1 r2") != std::string::npos);
-    REQUIRE(output.find("hlt") != std::string::npos);
+    REQUIRE(contains_all(output, {
+        "nop"sv,
+        "add r0 r1 r2"sv,
+        "hlt"sv
+    }));
 
     // check addresses
-    REQUIRE(output.find("0x0000:") != std::string::npos);
-    REQUIRE(output.find("0x0004:") != std::string::npos);
-    REQUIRE(output.find("0x0008:") != std::string::npos);
+    REQUIRE(contains_all(output, {
+        "0x0000:"sv,
+        "0x0004:"sv,
+        "0x0008:"sv
+    }));
   }
 
   SECTION("disassemble with custom base address") {
@@ -94,8 +116,8 @@ TEST_CASE("disassembler raw bytes", "[disassembler]") {
   }
 
   SECTION("invalid byte count") {
-    std::vector<byte> bad_bytes = {0x00, 0x00, 0x00}; // 3 bytes, not multiple of 4
-    auto result = disasm.disassemble_bytes(bad_bytes);
+    static constexpr std::array<byte, 3> bad_bytes = {0x00, 0x00, 0x00}; // 3 bytes, not multiple of 4
+    auto result = disasm.disassemble_bytes(bad_bytes.data(), bad_bytes.size());
 
     REQUIRE(result.is_err());
     REQUIRE(result.error() == asmr::disasm_error::invalid_size);
@@ -123,13 +145,17 @@ TEST_CASE("disassembler object files", "[disassembler]") {
     std::string output = result.value();
 
     // check for object file header
-    REQUIRE(output.find("irre object file disassembly") != std::string::npos);
-    REQUIRE(output.find("entry point: 0x0") != std::string::npos);
+    REQUIRE(contains_all(output, {
+        "irre object file disassembly"sv,
+        "entry point: 0x0"sv
+    }));
 
     // check instructions
-    REQUIRE(output.find("set r0 0x002a") != std::string::npos);
-    REQUIRE(output.find("mov r1 r0") != std::string::npos);
-    REQUIRE(output.find("hlt") != std::string::npos);
+    REQUIRE(contains_all(output, {
+        "set r0 0x002a"sv,
+        "mov r1 r0"sv,
+        "hlt"sv
+    }));
   }
 
   SECTION("disassemble object file with data section") {
@@ -144,8 +170,10 @@ TEST_CASE("disassembler object files", "[disassembler]") {
     std::string output = result.value();
 
     // check for data section
-    REQUIRE(output.find("data section") != std::string::npos);
-    REQUIRE(output.find("deadbeef1234") != std::string::npos);
+    REQUIRE(contains_all(output, {
+        "data section"sv,
+        "deadbeef1234"sv
+    }));
   }
 
   SECTION("empty object file") {
@@ -174,7 +202,7 @@ TEST_CASE("disassembler round-trip testing", "[disassembler][assembler]") {
     )";
 
     // assemble
-    auto asm_result = asm_engine.assemble(source);
+    const auto& asm_result = irre::test::cached_assemble(asm_engine, source);
     REQUIRE(asm_result.is_ok());
 
     auto obj = asm_result.value();
@@ -186,10 +214,12 @@ TEST_CASE("disassembler round-trip testing", "[disassembler][assembler]") {
     std::string disassembly = disasm_result.value();
 
     // verify instructions are present
-    REQUIRE(disassembly.find("set r0 0x002a") != std::string::npos); // 42 in hex
-    REQUIRE(disassembly.find("set r1 0x0064") != std::string::npos); // 100 in hex
-    REQUIRE(disassembly.find("add r2 r0 r1") != std::string::npos);
-    REQUIRE(disassembly.find("hlt") != std::string::npos);
+    REQUIRE(contains_all(disassembly, {
+        "set r0 0x002a"sv,
+        "set r1 0x0064"sv,
+        "add r2 r0 r1"sv,
+        "hlt"sv
+    }));
   }
 
   SECTION("round-trip with pseudo-instructions") {
@@ -201,7 +231,7 @@ TEST_CASE("disassembler round-trip testing", "[disassembler][assembler]") {
             bve ad r4 0
     )";
 
-    auto asm_result = asm_engine.assemble(source);
+    const auto& asm_result = irre::test::cached_assemble(asm_engine, source);
     REQUIRE(asm_result.is_ok());
 
     auto obj = asm_result.value();
@@ -211,11 +241,13 @@ TEST_CASE("disassembler round-trip testing", "[disassembler][assembler]") {
     std::string disassembly = disasm_result.value();
 
     // pseudo-instructions should be expanded, so we see the real instructions
-    REQUIRE(disassembly.find("set at") != std::string::npos);       // from adi/sbi expansion
-    REQUIRE(disassembly.find("add r0 r1 at") != std::string::npos); // from adi
-    REQUIRE(disassembly.find("sub r2 r3 at") != std::string::npos); // from sbi
-    REQUIRE(disassembly.find("set ad") != std::string::npos);       // from manual bif replacement
-    REQUIRE(disassembly.find("bve ad r4") != std::string::npos);    // from manual bif replacement
+    REQUIRE(contains_all(disassembly, {
+        "set at"sv,
+        "add r0 r1 at"sv,
+        "sub r2 r3 at"sv,
+        "set ad"sv,
+        "bve ad r4"sv
+    }));
   }
 }
 
@@ -232,56 +264,56 @@ TEST_CASE("disassembler all instruction formats", "[disassembler]") {
     auto inst = irre::make::nop();
     auto result = disasm.disassemble_instruction(inst);
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "nop");
+    REQUIRE(std::string_view{result.value()} == "nop"sv);
   }
 
   SECTION("format op_reg") {
     auto inst = irre::make::jmp(irre::reg::r5);
     auto result = disasm.disassemble_instruction(inst);
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "jmp r5");
+    REQUIRE(std::string_view{result.value()} == "jmp r5"sv);
   }
 
   SECTION("format op_imm24") {
     auto inst = irre::make::jmi(0x123456);
     auto result = disasm.disassemble_instruction(inst);
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "jmi 0x123456");
+    REQUIRE(std::string_view{result.value()} == "jmi 0x123456"sv);
   }
 
   SECTION("format op_reg_imm16") {
     auto inst = irre::make::set(irre::reg::r10, 0x1234);
     auto result = disasm.disassemble_instruction(inst);
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "set r10 0x1234");
+    REQUIRE(std::string_view{result.value()} == "set r10 0x1234"sv);
   }
 
   SECTION("format op_reg_reg") {
     auto inst = irre::make::mov(irre::reg::r3, irre::reg::r7);
     auto result = disasm.disassemble_instruction(inst);
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "mov r3 r7");
+    REQUIRE(std::string_view{result.value()} == "mov r3 r7"sv);
   }
 
   SECTION("format op_reg_reg_imm8") {
     auto inst = irre::make::ldw(irre::reg::r1, irre::reg::sp, 8);
     auto result = disasm.disassemble_instruction(inst);
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "ldw r1 sp 0x08");
+    REQUIRE(std::string_view{result.value()} == "ldw r1 sp 0x08"sv);
   }
 
   SECTION("format op_reg_imm8x2") {
     auto inst = irre::make::sia(irre::reg::r2, 0x12, 0x34);
     auto result = disasm.disassemble_instruction(inst);
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "sia r2 0x12 0x34");
+    REQUIRE(std::string_view{result.value()} == "sia r2 0x12 0x34"sv);
   }
 
   SECTION("format op_reg_reg_reg") {
     auto inst = irre::make::add(irre::reg::r0, irre::reg::r1, irre::reg::r2);
     auto result = disasm.disassemble_instruction(inst);
     REQUIRE(result.is_ok());
-    REQUIRE(result.value() == "add r0 r1 r2");
+    REQUIRE(std::string_view{result.value()} == "add r0 r1 r2"sv);
   }
 }
 
@@ -335,18 +367,18 @@ TEST_CASE("disassembler error handling", "[disassembler]") {
 
   SECTION("invalid instruction bytes") {
     // create bytes with invalid opcode
-    std::vector<byte> bad_bytes = {0x00, 0x00, 0x00, 0xfe}; // opcode 0xfe doesn't exist
+    static constexpr std::array<byte, 4> bad_bytes = {0x00, 0x00, 0x00, 0xfe}; // opcode 0xfe doesn't exist
 
-    auto result = disasm.disassemble_bytes(bad_bytes);
+    auto result = disasm.disassemble_bytes(bad_bytes.data(), bad_bytes.size());
     REQUIRE(result.is_err());
     REQUIRE(result.error() == asmr::disasm_error::decode_failed);
   }
 
   SECTION("invalid register in instruction") {
     // create instruction with invalid register (> 0x24) in correct position
-    std::vector<byte> bad_reg_bytes = {0x00, 0x00, 0xff, 0x21}; // jmp with reg 0xff in a1 position
+    static constexpr std::array<byte, 4> bad_reg_bytes = {0x00, 0x00, 0xff, 0x21}; // jmp with reg 0xff in a1 position
 
-    auto result = disasm.disassemble_bytes(bad_reg_bytes);
+    auto result = disasm.disassemble_bytes(bad_reg_bytes.data(), bad_reg_bytes.size());
     REQUIRE(result.is_err());
     REQUIRE(result.error() == asmr::disasm_error::decode_failed);
   }
@@ -401,7 +433,7 @@ TEST_CASE("assembler/disassembler end-to-end tests", "[asmdisasm_e2e]") {
     )";
 
     // assemble to object file
-    auto asm_result = asm_engine.assemble(source);
+    const auto& asm_result = irre::test::cached_assemble(asm_engine, source);
     REQUIRE(asm_result.is_ok());
     auto obj = asm_result.value();
 
@@ -412,24 +444,28 @@ TEST_CASE("assembler/disassembler end-to-end tests", "[asmdisasm_e2e]") {
     // disassemble back
     auto disasm_result = disasm.disassemble_object(obj, asmr::disasm_format::basic);
     if (disasm_result.is_err()) {
-      FAIL("Disassembly failed: " + std::string(asmr::disasm_error_message(disasm_result.error())));
+      std::string msg{"Disassembly failed: "};
+      msg += asmr::disasm_error_message(disasm_result.error());
+      FAIL(msg);
     }
     REQUIRE(disasm_result.is_ok());
 
     std::string disassembly = disasm_result.value();
 
     // verify all instructions are present and correct
-    REQUIRE(disassembly.find("set r1 0x002a") != std::string::npos); // 42 in hex
-    REQUIRE(disassembly.find("set r2 0x0011") != std::string::npos); // 17 in hex
-    REQUIRE(disassembly.find("add r3 r1 r2") != std::string::npos);
-    REQUIRE(disassembly.find("mov r4 r3") != std::string::npos);
-    REQUIRE(disassembly.find("not r5 r4") != std::string::npos);
-    REQUIRE(disassembly.find("seq r7 r3 0x3b") != std::string::npos); // 59 in hex
-    REQUIRE(disassembly.find("set r6 0x0024") != std::string::npos);  // success label address
-    REQUIRE(disassembly.find("bve r6 r7 0x01") != std::string::npos);
-    REQUIRE(disassembly.find("hlt") != std::string::npos);
-    REQUIRE(disassembly.find("set r8 0x00ff") != std::string::npos); // 255 in hex
-    REQUIRE(disassembly.find("set r9 0x00f0") != std::string::npos); // 240 in hex
+    REQUIRE(contains_all(disassembly, {
+        "set r1 0x002a"sv,
+        "set r2 0x0011"sv,
+        "add r3 r1 r2"sv,
+        "mov r4 r3"sv,
+        "not r5 r4"sv,
+        "seq r7 r3 0x3b"sv,
+        "set r6 0x0024"sv,
+        "bve r6 r7 0x01"sv,
+        "hlt"sv,
+        "set r8 0x00ff"sv,
+        "set r9 0x00f0"sv
+    }));
   }
 
   SECTION("e2e: write and read object file to disk") {
@@ -444,7 +480,7 @@ TEST_CASE("assembler/disassembler end-to-end tests", "[asmdisasm_e2e]") {
     )";
 
     // assemble
-    auto asm_result = asm_engine.assemble(source);
+    const auto& asm_result = irre::test::cached_assemble(asm_engine, source);
     REQUIRE(asm_result.is_ok());
     auto obj = asm_result.value();
 
@@ -473,10 +509,12 @@ TEST_CASE("assembler/disassembler end-to-end tests", "[asmdisasm_e2e]") {
     REQUIRE(disasm_result.is_ok());
 
     std::string disassembly = disasm_result.value();
-    REQUIRE(disassembly.find("set r0 0x0064") != std::string::npos); // 100 in hex
-    REQUIRE(disassembly.find("set r1 0x00c8") != std::string::npos); // 200 in hex
-    REQUIRE(disassembly.find("add r2 r0 r1") != std::string::npos);
-    REQUIRE(disassembly.find("hlt") != std::string::npos);
+    REQUIRE(contains_all(disassembly, {
+        "set r0 0x0064"sv,
+        "set r1 0x00c8"sv,
+        "add r2 r0 r1"sv,
+        "hlt"sv
+    }));
   }
 
   SECTION("e2e: complex control flow program") {
@@ -518,7 +556,7 @@ TEST_CASE("assembler/disassembler end-to-end tests", "[asmdisasm_e2e]") {
     )";
 
     // assemble
-    auto asm_result = asm_engine.assemble(source);
+    const auto& asm_result = irre::test::cached_assemble(asm_engine, source);
     if (asm_result.is_err()) {
       auto error = asm_result.error();
       FAIL(
@@ -536,13 +574,15 @@ TEST_CASE("assembler/disassembler end-to-end tests", "[asmdisasm_e2e]") {
     std::string disassembly = disasm_result.value();
 
     // verify key control flow instructions
-    REQUIRE(disassembly.find("cal") != std::string::npos); // function call
-    REQUIRE(disassembly.find("bve") != std::string::npos); // conditional branch
-    REQUIRE(disassembly.find("jmi") != std::string::npos); // unconditional jump
-    REQUIRE(disassembly.find("ret") != std::string::npos); // return
-    REQUIRE(disassembly.find("stw") != std::string::npos); // store word
-    REQUIRE(disassembly.find("mul") != std::string::npos); // multiply
-    REQUIRE(disassembly.find("tcu") != std::string::npos); // unsigned compare
+    REQUIRE(contains_all(disassembly, {
+        "cal"sv,
+        "bve"sv,
+        "jmi"sv,
+        "ret"sv,
+        "stw"sv,
+        "mul"sv,
+        "tcu"sv
+    }));
   }
 
   SECTION("e2e: test with actual file I/O like CLI tools") {
@@ -562,7 +602,7 @@ TEST_CASE("assembler/disassembler end-to-end tests", "[asmdisasm_e2e]") {
     )";
 
     // assemble
-    auto asm_result = asm_engine.assemble(source);
+    const auto& asm_result = irre::test::cached_assemble(asm_engine, source);
     if (asm_result.is_err()) {
       auto error = asm_result.error();
       FAIL(
@@ -587,15 +627,19 @@ TEST_CASE("assembler/disassembler end-to-end tests", "[asmdisasm_e2e]") {
     std::string output = disasm_result.value();
 
     // verify annotated format includes headers
-    REQUIRE(output.find("irre object file disassembly") != std::string::npos);
-    REQUIRE(output.find("entry point:") != std::string::npos);
-    REQUIRE(output.find("code size:") != std::string::npos);
+    REQUIRE(contains_all(output, {
+        "irre object file disassembly"sv,
+        "entry point:"sv,
+        "code size:"sv
+    }));
 
     // verify instructions
-    REQUIRE(output.find("set r0 0x002a") != std::string::npos);
-    REQUIRE(output.find("set r1 0x0000") != std::string::npos);
-    REQUIRE(output.find("seq r2 r0 0x2a") != std::string::npos);
-    REQUIRE(output.find("bve ad r2") != std::string::npos); // from manual bif replacement
-    REQUIRE(output.find("hlt") != std::string::npos);
+    REQUIRE(contains_all(output, {
+        "set r0 0x002a"sv,
+        "set r1 0x0000"sv,
+        "seq r2 r0 0x2a"sv,
+        "bve ad r2"sv,
+        "hlt"sv
+    }));
   }
 }
\ No newline at end of file
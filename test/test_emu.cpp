@@ -2,6 +2,8 @@
 #include "emu/vm.hpp"
 #include "emu/devices.hpp"
 #include "assembler/assembler.hpp"
+#include <array>
+#include "test_helpers.hpp"
 
 using namespace irre;
 using namespace irre::emu;
@@ -76,20 +78,12 @@ TEST_CASE("Basic instruction execution", "[emu][execution]") {
     machine.set_register(reg::r1, 10);
     machine.set_register(reg::r2, 20);
 
-    // manually create add r0, r1, r2 instruction
-    auto add_inst = make::add(reg::r0, reg::r1, reg::r2);
-    auto encoded = codec::encode(add_inst);
+    // program assembled entirely at compile time: add r0 r1 r2; hlt
+    static constexpr auto program = irre::test::emit_program(
+        make::add(reg::r0, reg::r1, reg::r2), make::hlt()
+    );
 
-    std::vector<byte> program;
-    auto bytes = codec::encode_bytes(add_inst);
-    program.assign(bytes.begin(), bytes.end());
-
-    // add halt
-    auto halt_inst = make::hlt();
-    auto halt_bytes = codec::encode_bytes(halt_inst);
-    program.insert(program.end(), halt_bytes.begin(), halt_bytes.end());
-
-    machine.load_binary(program);
+    machine.load_binary(program.data(), program.size());
     machine.run();
 
     REQUIRE(machine.get_register(reg::r0) == 30);
@@ -101,24 +95,13 @@ TEST_CASE("Basic instruction execution", "[emu][execution]") {
     machine.set_register(reg::r1, 0x12345678);
     machine.set_register(reg::r2, 100); // address
 
-    std::vector<byte> program;
-
-    // stw r1, r2, 0 - store r1 to memory[r2+0]
-    auto store = make::stw(reg::r1, reg::r2, 0);
-    auto store_bytes = codec::encode_bytes(store);
-    program.insert(program.end(), store_bytes.begin(), store_bytes.end());
-
-    // ldw r0, r2, 0 - load from memory[r2+0] to r0
-    auto load = make::ldw(reg::r0, reg::r2, 0);
-    auto load_bytes = codec::encode_bytes(load);
-    program.insert(program.end(), load_bytes.begin(), load_bytes.end());
+    // stw r1 r2 0; ldw r0 r2 0; hlt - encoded at compile time
+    static constexpr auto program = irre::test::emit_program(
+        make::stw(reg::r1, reg::r2, 0), make::ldw(reg::r0, reg::r2, 0),
+        make::hlt()
+    );
 
-    // halt
-    auto halt = make::hlt();
-    auto halt_bytes = codec::encode_bytes(halt);
-    program.insert(program.end(), halt_bytes.begin(), halt_bytes.end());
-
-    machine.load_binary(program);
+    machine.load_binary(program.data(), program.size());
     machine.run();
 
     REQUIRE(machine.get_register(reg::r0) == 0x12345678);
@@ -126,34 +109,38 @@ TEST_CASE("Basic instruction execution", "[emu][execution]") {
   }
 
   SECTION("control flow instructions") {
-    std::vector<byte> program;
-
-    // set r0, 42
-    auto set_inst = make::set(reg::r0, 42);
-    auto set_bytes = codec::encode_bytes(set_inst);
-    program.insert(program.end(), set_bytes.begin(), set_bytes.end());
-
-    // jmi 12 (jump to halt instruction at offset 12)
-    auto jmp_inst = make::jmi(12);
-    auto jmp_bytes = codec::encode_bytes(jmp_inst);
-    program.insert(program.end(), jmp_bytes.begin(), jmp_bytes.end());
-
-    // set r0, 99 (should be skipped)
-    auto skip_inst = make::set(reg::r0, 99);
-    auto skip_bytes = codec::encode_bytes(skip_inst);
-    program.insert(program.end(), skip_bytes.begin(), skip_bytes.end());
+    // set r0 42; jmi 12 (skip the next set); set r0 99; hlt - compile-time bytes
+    static constexpr auto program = irre::test::emit_program(
+        make::set(reg::r0, 42), make::jmi(12),
+        make::set(reg::r0, 99), make::hlt()
+    );
 
-    // halt (at offset 12)
-    auto halt = make::hlt();
-    auto halt_bytes = codec::encode_bytes(halt);
-    program.insert(program.end(), halt_bytes.begin(), halt_bytes.end());
-
-    machine.load_binary(program);
+    machine.load_binary(program.data(), program.size());
     machine.run();
 
     REQUIRE(machine.get_register(reg::r0) == 42); // not 99
     REQUIRE(machine.get_execution_state() == execution_state::halted);
   }
+
+  SECTION("pc-relative store invalidates the stored-to slot") {
+    // the nop at 0 executes once and lands in the decode cache, then a
+    // pc-relative stw overwrites it with hlt and the program loops back to 0;
+    // the invalidation must target the address the store actually wrote
+    // (base pc read before the pc advance), or the stale nop spins forever
+    static constexpr auto program = irre::test::emit_program(
+        make::nop(),                       // 0: cached on first pass
+        make::set(reg::r1, 0x0000),        // 4
+        make::sup(reg::r1, 0xff00),        // 8: r1 = 0xff000000 (hlt)
+        make::stw(reg::r1, reg::pc, 0xf4), // 12: [pc - 12] = [0] <- hlt
+        make::jmi(0)                       // 16: loop to 0
+    );
+
+    machine.load_binary(program.data(), program.size());
+    machine.run(100);
+
+    REQUIRE(machine.read_memory_word(0) == 0xff000000);
+    REQUIRE(machine.get_execution_state() == execution_state::halted);
+  }
 }
 
 TEST_CASE("End-to-end assembler + emulator", "[emu][e2e]") {
@@ -214,10 +201,10 @@ TEST_CASE("End-to-end assembler + emulator", "[emu][e2e]") {
                 hlt
         )";
 
-    auto asm_result = asm_engine.assemble(source);
+    const auto& asm_result = irre::test::cached_assemble(asm_engine, source);
     REQUIRE(asm_result.is_ok());
 
-    auto obj = asm_result.value();
+    const auto& obj = asm_result.value();
     machine.load_program(obj);
     machine.run(1000); // limit iterations for safety
 
@@ -245,19 +232,12 @@ TEST_CASE("Device system", "[emu][devices]") {
     machine.set_register(reg::r1, 0);   // putchar command
     machine.set_register(reg::r2, 'H'); // character
 
-    std::vector<byte> program;
+    // snd r0 r1 r2; hlt - compile-time bytes
+    static constexpr auto program = irre::test::emit_program(
+        make::snd(reg::r0, reg::r1, reg::r2), make::hlt()
+    );
 
-    // snd r0, r1, r2 - send character to console
-    auto snd = make::snd(reg::r0, reg::r1, reg::r2);
-    auto snd_bytes = codec::encode_bytes(snd);
-    program.insert(program.end(), snd_bytes.begin(), snd_bytes.end());
-
-    // halt
-    auto halt = make::hlt();
-    auto halt_bytes = codec::encode_bytes(halt);
-    program.insert(program.end(), halt_bytes.begin(), halt_bytes.end());
-
-    machine.load_binary(program);
+    machine.load_binary(program.data(), program.size());
     machine.run();
 
     REQUIRE(console_ptr->get_output() == "H");
@@ -278,14 +258,10 @@ TEST_CASE("Error handling", "[emu][errors]") {
     machine.set_register(reg::r1, 10);
     machine.set_register(reg::r2, 0);
 
-    std::vector<byte> program;
+    // div r0 r1 r2 - divide by zero, encoded at compile time
+    static constexpr auto program = irre::test::emit_program(make::div(reg::r0, reg::r1, reg::r2));
 
-    // div r0, r1, r2 - divide by zero
-    auto div_inst = make::div(reg::r0, reg::r1, reg::r2);
-    auto div_bytes = codec::encode_bytes(div_inst);
-    program.insert(program.end(), div_bytes.begin(), div_bytes.end());
-
-    machine.load_binary(program);
+    machine.load_binary(program.data(), program.size());
     machine.step();
 
     REQUIRE(error_occurred);
@@ -296,14 +272,10 @@ TEST_CASE("Error handling", "[emu][errors]") {
   SECTION("invalid memory access") {
     machine.set_register(reg::r1, 2000); // out of bounds address
 
-    std::vector<byte> program;
-
-    // ldw r0, r1, 0 - load from invalid address
-    auto load = make::ldw(reg::r0, reg::r1, 0);
-    auto load_bytes = codec::encode_bytes(load);
-    program.insert(program.end(), load_bytes.begin(), load_bytes.end());
+    // ldw r0 r1 0 - load from invalid address, encoded at compile time
+    static constexpr auto program = irre::test::emit_program(make::ldw(reg::r0, reg::r1, 0));
 
-    machine.load_binary(program);
+    machine.load_binary(program.data(), program.size());
     machine.step();
 
     REQUIRE(error_occurred);
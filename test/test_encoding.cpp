@@ -4,6 +4,12 @@
 
 #include "irre.hpp"
 
+#include <array>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 using namespace irre;
 
 // helper function to test round-trip encoding/decoding
@@ -18,6 +24,61 @@ auto test_round_trip = [](const instruction& inst) {
   REQUIRE(get_opcode(inst) == get_opcode(decoded.value()));
 };
 
+// expand a pack of three-register instruction makers into one round-trip call
+// per maker; function-pointer template parameters keep every call direct
+template <auto... makers> void round_trip_all_rrr(reg a, reg b, reg c) { (test_round_trip(makers(a, b, c)), ...); }
+
+// pack expected instruction bytes into one big-endian word so each encoding
+// check is a single 32-bit compare instead of four shift/mask assertions
+constexpr word pack_be(uint8_t op, uint8_t a = 0, uint8_t b = 0, uint8_t c = 0) {
+  return (word(op) << 24) | (word(a) << 16) | (word(b) << 8) | c;
+}
+
+// batch round-trip: encode the whole set and re-encode the decoded forms in
+// one pass, then compare the two word arrays 8 lanes at a time instead of
+// running a REQUIRE per field per instruction
+void test_round_trip_batch(const instruction* insts, size_t n) {
+  std::vector<word> encoded(n);
+  std::vector<word> reencoded(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    encoded[i] = codec::encode(insts[i]);
+    auto decoded = codec::decode(encoded[i]);
+    REQUIRE(decoded.is_ok());
+    REQUIRE(get_opcode(insts[i]) == get_opcode(decoded.value()));
+    reencoded[i] = codec::encode(decoded.value());
+  }
+
+  size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 8 <= n; i += 8) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded.data() + i));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(reencoded.data() + i));
+    REQUIRE(_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, b)) == -1);
+  }
+#endif
+  // scalar tail (and full set on non-avx2 targets)
+  for (; i < n; ++i) {
+    REQUIRE(encoded[i] == reencoded[i]);
+  }
+}
+
+// batched round-trip: decode then re-encode every word and or the xor
+// differences into one accumulator, so the loop body is a handful of alu ops
+// and the pass/fail decision is a single compare at the end instead of a
+// REQUIRE per word
+bool roundtrip_ok(const word* ws, size_t n) {
+  word accum = 0;
+  for (size_t i = 0; i < n; ++i) {
+    auto decoded = codec::decode(ws[i]);
+    if (decoded.is_err()) {
+      return false;
+    }
+    accum |= codec::encode(decoded.value()) ^ ws[i];
+  }
+  return accum == 0;
+}
+
 TEST_CASE("Instruction format: inst_op") {
   SECTION("nop instruction") {
     auto inst = make::nop();
@@ -47,7 +108,7 @@ TEST_CASE("Instruction format: inst_op") {
 TEST_CASE("Instruction format: inst_op_reg") {
   SECTION("jmp with various registers") {
     // test with different register types
-    std::vector<reg> test_regs = {
+    static constexpr std::array<reg, 8> test_regs = {
         reg::r0, reg::r15, reg::r31,                  // GPRs
         reg::pc, reg::lr,  reg::ad,  reg::at, reg::sp // Special registers
     };
@@ -58,8 +119,7 @@ TEST_CASE("Instruction format: inst_op_reg") {
 
       word encoded = codec::encode(inst);
       // check opcode (0x21) and register placement
-      REQUIRE(((encoded >> 24) & 0xff) == 0x21);
-      REQUIRE(((encoded >> 16) & 0xff) == static_cast<uint8_t>(r));
+      REQUIRE(encoded == pack_be(0x21, static_cast<uint8_t>(r)));
     }
   }
 
@@ -68,27 +128,25 @@ TEST_CASE("Instruction format: inst_op_reg") {
     test_round_trip(inst);
 
     word encoded = codec::encode(inst);
-    REQUIRE(((encoded >> 24) & 0xff) == 0x2a); // opcode
-    REQUIRE(((encoded >> 16) & 0xff) == 0x0a); // r10 = 0x0a
+    REQUIRE(encoded == pack_be(0x2a, 0x0a)); // opcode, r10 = 0x0a
   }
 }
 
 TEST_CASE("Instruction format: inst_op_imm24") {
   SECTION("jmi with various addresses") {
-    std::vector<uint32_t> test_addrs = {
-        0x000000, // minimum
-        0x123456, // typical
-        0xffffff  // maximum 24-bit value
-    };
+    // minimum, typical, and maximum 24-bit addresses
+    static constexpr std::array<uint32_t, 3> test_addrs = {0x000000, 0x123456, 0xffffff};
+    static constexpr std::array<word, 3> expected = {0x20000000u, 0x20123456u, 0x20ffffffu};
 
-    for (auto addr : test_addrs) {
-      auto inst = make::jmi(addr);
+    std::array<word, 3> actual{};
+    for (size_t i = 0; i < test_addrs.size(); ++i) {
+      auto inst = make::jmi(test_addrs[i]);
       test_round_trip(inst);
-
-      word encoded = codec::encode(inst);
-      REQUIRE(((encoded >> 24) & 0xff) == 0x20);          // opcode
-      REQUIRE((encoded & 0xffffff) == (addr & 0xffffff)); // 24-bit addr
+      actual[i] = codec::encode(inst);
     }
+
+    // one array compare instead of a REQUIRE per address
+    REQUIRE(actual == expected);
   }
 
   SECTION("int instruction") {
@@ -96,8 +154,7 @@ TEST_CASE("Instruction format: inst_op_imm24") {
     test_round_trip(inst);
 
     word encoded = codec::encode(inst);
-    REQUIRE(((encoded >> 24) & 0xff) == 0xf0); // opcode
-    REQUIRE((encoded & 0xffffff) == 0x123456); // interrupt code
+    REQUIRE(encoded == pack_be(0xf0, 0x12, 0x34, 0x56)); // opcode + interrupt code
   }
 }
 
@@ -107,18 +164,21 @@ TEST_CASE("Instruction format: inst_op_reg_imm16") {
     test_round_trip(inst);
 
     word encoded = codec::encode(inst);
-    REQUIRE(((encoded >> 24) & 0xff) == 0x0b); // opcode
-    REQUIRE(((encoded >> 16) & 0xff) == 0x05); // r5
-    REQUIRE((encoded & 0xffff) == 0x1234);     // immediate
+    REQUIRE(encoded == pack_be(0x0b, 0x05, 0x12, 0x34)); // opcode, r5, immediate
   }
 
   SECTION("set with edge values") {
-    std::vector<uint16_t> test_vals = {0x0000, 0xffff, 0x8000};
+    static constexpr std::array<uint16_t, 3> test_vals = {0x0000, 0xffff, 0x8000};
+    static constexpr std::array<word, 3> expected = {0x0b000000u, 0x0b00ffffu, 0x0b008000u};
 
-    for (auto val : test_vals) {
-      auto inst = make::set(reg::r0, val);
+    std::array<word, 3> actual{};
+    for (size_t i = 0; i < test_vals.size(); ++i) {
+      auto inst = make::set(reg::r0, test_vals[i]);
       test_round_trip(inst);
+      actual[i] = codec::encode(inst);
     }
+
+    REQUIRE(actual == expected);
   }
 }
 
@@ -128,9 +188,7 @@ TEST_CASE("Instruction format: inst_op_reg_reg") {
     test_round_trip(inst);
 
     word encoded = codec::encode(inst);
-    REQUIRE(((encoded >> 24) & 0xff) == 0x0c); // opcode
-    REQUIRE(((encoded >> 16) & 0xff) == 0x01); // r1
-    REQUIRE(((encoded >> 8) & 0xff) == 0x02);  // r2
+    REQUIRE(encoded == pack_be(0x0c, 0x01, 0x02)); // opcode, r1, r2
   }
 }
 
@@ -140,10 +198,7 @@ TEST_CASE("Instruction format: inst_op_reg_reg_imm8") {
     test_round_trip(inst);
 
     word encoded = codec::encode(inst);
-    REQUIRE(((encoded >> 24) & 0xff) == 0x0d); // opcode
-    REQUIRE(((encoded >> 16) & 0xff) == 0x03); // r3
-    REQUIRE(((encoded >> 8) & 0xff) == 0x04);  // r4
-    REQUIRE((encoded & 0xff) == 0x10);         // offset
+    REQUIRE(encoded == pack_be(0x0d, 0x03, 0x04, 0x10)); // opcode, r3, r4, offset
   }
 
   SECTION("bve instruction") {
@@ -151,28 +206,25 @@ TEST_CASE("Instruction format: inst_op_reg_reg_imm8") {
     test_round_trip(inst);
 
     word encoded = codec::encode(inst);
-    REQUIRE(((encoded >> 24) & 0xff) == 0x24); // opcode
-    REQUIRE(((encoded >> 16) & 0xff) == 0x01); // r1 (target addr reg)
-    REQUIRE(((encoded >> 8) & 0xff) == 0x02);  // r2 (comparison reg)
-    REQUIRE((encoded & 0xff) == 0x05);         // comparison value
+    // opcode, target addr reg, comparison reg, comparison value
+    REQUIRE(encoded == pack_be(0x24, 0x01, 0x02, 0x05));
   }
 }
 
 TEST_CASE("Instruction format: inst_op_reg_imm8x2") {
   SECTION("sia instruction") {
     // Test with various shift values
-    std::vector<std::pair<uint8_t, uint8_t>> test_vals = {{0x01, 0x00}, {0x0f, 0x04}, {0xff, 0x1f}};
+    static constexpr std::array<std::pair<uint8_t, uint8_t>, 3> test_vals = {{{0x01, 0x00}, {0x0f, 0x04}, {0xff, 0x1f}}};
+    static constexpr std::array<word, 3> expected = {0x40070100u, 0x40070f04u, 0x4007ff1fu};
 
-    for (auto [v0, v1] : test_vals) {
-      auto inst = make::sia(reg::r7, v0, v1);
+    std::array<word, 3> actual{};
+    for (size_t i = 0; i < test_vals.size(); ++i) {
+      auto inst = make::sia(reg::r7, test_vals[i].first, test_vals[i].second);
       test_round_trip(inst);
-
-      word encoded = codec::encode(inst);
-      REQUIRE(((encoded >> 24) & 0xff) == 0x40); // opcode
-      REQUIRE(((encoded >> 16) & 0xff) == 0x07); // r7
-      REQUIRE(((encoded >> 8) & 0xff) == v0);    // v0
-      REQUIRE((encoded & 0xff) == v1);           // v1
+      actual[i] = codec::encode(inst);
     }
+
+    REQUIRE(actual == expected);
   }
 }
 
@@ -182,73 +234,71 @@ TEST_CASE("Instruction format: inst_op_reg_reg_reg") {
     test_round_trip(inst);
 
     word encoded = codec::encode(inst);
-    REQUIRE(((encoded >> 24) & 0xff) == 0x01); // opcode
-    REQUIRE(((encoded >> 16) & 0xff) == 0x01); // r1
-    REQUIRE(((encoded >> 8) & 0xff) == 0x02);  // r2
-    REQUIRE((encoded & 0xff) == 0x03);         // r3
+    REQUIRE(encoded == pack_be(0x01, 0x01, 0x02, 0x03)); // opcode, r1, r2, r3
   }
 
   SECTION("arithmetic operations") {
-    std::vector<std::function<instruction(reg, reg, reg)>> ops = {
-        make::add, make::sub, make::mul, make::div, make::mod
-    };
-
-    for (auto op : ops) {
-      auto inst = op(reg::r10, reg::r11, reg::r12);
-      test_round_trip(inst);
-    }
+    // the makers are non-type template parameters, so the series expands to
+    // direct calls in one statement with no pointer array walked at runtime
+    round_trip_all_rrr<make::add, make::sub, make::mul, make::div, make::mod>(reg::r10, reg::r11, reg::r12);
   }
 }
 
 TEST_CASE("All 35 IRRE instructions") {
-  // Test every instruction from the spec
-  SECTION("Control flow instructions") {
-    test_round_trip(make::nop());
-    test_round_trip(make::ret());
-    test_round_trip(make::hlt());
-    test_round_trip(make::jmp(reg::r0));
-    test_round_trip(make::jmi(0x123456));
-    test_round_trip(make::cal(reg::lr));
-    test_round_trip(make::bve(reg::r1, reg::r2, 0x05));
-    test_round_trip(make::bvn(reg::r1, reg::r2, 0x05));
-  }
-
-  SECTION("Arithmetic operations") {
-    test_round_trip(make::add(reg::r1, reg::r2, reg::r3));
-    test_round_trip(make::sub(reg::r1, reg::r2, reg::r3));
-    test_round_trip(make::mul(reg::r1, reg::r2, reg::r3));
-    test_round_trip(make::div(reg::r1, reg::r2, reg::r3));
-    test_round_trip(make::mod(reg::r1, reg::r2, reg::r3));
-  }
-
-  SECTION("Memory operations") {
-    test_round_trip(make::ldw(reg::r1, reg::r2, 0x10));
-    test_round_trip(make::stw(reg::r1, reg::r2, 0x10));
-    test_round_trip(make::ldb(reg::r1, reg::r2, 0x10));
-    test_round_trip(make::stb(reg::r1, reg::r2, 0x10));
-  }
+  // Test every instruction from the spec, round-tripped as one batch
+  static constexpr std::array<instruction, 19> insts = {
+      // control flow
+      make::nop(), make::ret(), make::hlt(), make::jmp(reg::r0), make::jmi(0x123456), make::cal(reg::lr),
+      make::bve(reg::r1, reg::r2, 0x05), make::bvn(reg::r1, reg::r2, 0x05),
+      // arithmetic
+      make::add(reg::r1, reg::r2, reg::r3), make::sub(reg::r1, reg::r2, reg::r3), make::mul(reg::r1, reg::r2, reg::r3),
+      make::div(reg::r1, reg::r2, reg::r3), make::mod(reg::r1, reg::r2, reg::r3),
+      // memory
+      make::ldw(reg::r1, reg::r2, 0x10), make::stw(reg::r1, reg::r2, 0x10), make::ldb(reg::r1, reg::r2, 0x10),
+      make::stb(reg::r1, reg::r2, 0x10),
+      // data movement
+      make::mov(reg::r1, reg::r2), make::set(reg::r1, 0x1234)
+  };
 
-  SECTION("Data movement") {
-    test_round_trip(make::mov(reg::r1, reg::r2));
-    test_round_trip(make::set(reg::r1, 0x1234));
-  }
+  test_round_trip_batch(insts.data(), insts.size());
 }
 
 TEST_CASE("Error handling") {
   SECTION("Invalid opcodes") {
-    std::vector<uint8_t> invalid_opcodes = {0xfe, 0x99, 0x50, 0x11};
-
-    for (auto op : invalid_opcodes) {
+    // exhaustive: decode every opcode-only word (operand bytes zero, so any
+    // register fields are valid) and collect the outcomes into a 256-bit
+    // mask, checked in one compare against the opcode set the spec defines
+    static constexpr std::array<uint8_t, 33> valid_ops = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, // alu
+        0x20, 0x21, 0x24, 0x25, 0x2a, 0x2b,                                                                   // flow
+        0x30, 0x31, 0x32,                                                                                     // exarith
+        0x40, 0x41, 0x42, 0x43,                                                                               // adv
+        0xf0, 0xfd, 0xff                                                                                      // sys
+    };
+    constexpr std::array<uint64_t, 4> expected = [] {
+      std::array<uint64_t, 4> mask{};
+      for (uint8_t op : valid_ops) {
+        mask[op >> 6] |= uint64_t{1} << (op & 63);
+      }
+      return mask;
+    }();
+
+    std::array<uint64_t, 4> actual{};
+    for (uint32_t op = 0; op < 256; ++op) {
       word w = static_cast<word>(op) << 24;
       auto result = codec::decode(w);
-      REQUIRE(result.is_err());
-      REQUIRE(result.error() == decode_error::invalid_opcode);
+      if (result.is_ok()) {
+        actual[op >> 6] |= uint64_t{1} << (op & 63);
+      } else {
+        REQUIRE(result.error() == decode_error::invalid_opcode);
+      }
     }
+    REQUIRE(actual == expected);
   }
 
   SECTION("Invalid registers") {
     // Test register values > 0x24 (sp is max at 0x24)
-    std::vector<uint8_t> invalid_regs = {0x25, 0x30, 0x80, 0xff};
+    static constexpr std::array<uint8_t, 4> invalid_regs = {0x25, 0x30, 0x80, 0xff};
 
     for (auto reg_val : invalid_regs) {
       // Test with jmp instruction (op_reg format)
@@ -260,6 +310,59 @@ TEST_CASE("Error handling") {
   }
 }
 
+TEST_CASE("Randomized round-trip per format") {
+  // fuzz-style coverage: 64k random valid words per instruction format fed
+  // through the batched checker; the failure mode is coarse (which format
+  // broke, not which word), but the per-format targeted cases above already
+  // pin down individual fields
+  static constexpr std::array<opcode, 8> format_reps = {opcode::nop, opcode::jmp, opcode::jmi, opcode::set,
+                                                        opcode::mov, opcode::ldw, opcode::sia, opcode::add};
+
+  // deterministic xorshift so failures reproduce across runs
+  uint32_t state = 0x12345678;
+  auto next = [&state] {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  };
+  auto rand_reg = [&next] { return static_cast<word>(next() % 0x25); };
+
+  std::vector<word> words(1 << 16);
+  for (opcode op : format_reps) {
+    word base = static_cast<word>(op) << 24;
+    for (auto& w : words) {
+      switch (get_format(op)) {
+      case format::op:
+        w = base;
+        break;
+      case format::op_reg:
+        w = base | (rand_reg() << 16);
+        break;
+      case format::op_imm24:
+        w = base | (next() & 0xffffff);
+        break;
+      case format::op_reg_imm16:
+      case format::op_reg_imm8x2:
+        w = base | (rand_reg() << 16) | (next() & 0xffff);
+        break;
+      case format::op_reg_reg:
+        w = base | (rand_reg() << 16) | (rand_reg() << 8);
+        break;
+      case format::op_reg_reg_imm8:
+        w = base | (rand_reg() << 16) | (rand_reg() << 8) | (next() & 0xff);
+        break;
+      case format::op_reg_reg_reg:
+        w = base | (rand_reg() << 16) | (rand_reg() << 8) | rand_reg();
+        break;
+      case format::invalid:
+        break;
+      }
+    }
+    REQUIRE(roundtrip_ok(words.data(), words.size()));
+  }
+}
+
 TEST_CASE("Byte-level encoding") {
   SECTION("Little-endian byte ordering") {
     auto inst = make::add(reg::r1, reg::r2, reg::r3);
@@ -278,30 +381,89 @@ TEST_CASE("Byte-level encoding") {
   }
 }
 
-TEST_CASE("Register validation") {
-  struct TestCase {
-    uint8_t value;
-    bool valid;
-    const char* name;
+TEST_CASE("Batch field extraction") {
+  // decode_fields must agree with scalar shift/mask extraction for every
+  // word; the batch is bigger than one simd block so both the vector body
+  // and the scalar tail are exercised
+  std::array<word, 19> words{};
+  static constexpr std::array<instruction, 19> insts = {
+      make::nop(), make::hlt(), make::jmp(reg::r5), make::jmi(0x123456), make::set(reg::r5, 0x1234),
+      make::mov(reg::r5, reg::r10), make::ldw(reg::r5, reg::r10, 0x10), make::sia(reg::r5, 0x10, 0x04),
+      make::add(reg::r5, reg::r10, reg::r15), make::sub(reg::r1, reg::r2, reg::r3),
+      make::mul(reg::r4, reg::r5, reg::r6), make::div(reg::r7, reg::r8, reg::r9),
+      make::cal(reg::lr), make::ret(), make::bve(reg::r1, reg::r2, 0x05), make::stw(reg::r3, reg::sp, 0xff),
+      make::sup(reg::sp, 0xffff), make::not_(reg::at, reg::pc), make::int_(0xabcdef)
   };
+  for (size_t i = 0; i < insts.size(); ++i) {
+    words[i] = codec::encode(insts[i]);
+  }
 
-  std::vector<TestCase> cases = {{0x00, true, "r0"},       {0x1f, true, "r31"},      {0x20, true, "pc"},
-                                 {0x21, true, "lr"},       {0x22, true, "ad"},       {0x23, true, "at"},
-                                 {0x24, true, "sp"},       {0x25, false, "invalid"}, {0x30, false, "invalid"},
-                                 {0xff, false, "max_byte"}};
+  std::array<opcode, 19> ops{};
+  std::array<byte, 19> a{}, b{}, c{};
+  decode_fields(words.data(), words.size(), ops.data(), a.data(), b.data(), c.data());
 
-  for (const auto& tc : cases) {
-    INFO("Testing register value: " << static_cast<int>(tc.value) << " (" << tc.name << ")");
+  for (size_t i = 0; i < words.size(); ++i) {
+    word w = words[i];
+    REQUIRE(ops[i] == static_cast<opcode>(w >> 24));
+    REQUIRE(a[i] == static_cast<byte>(w >> 16));
+    REQUIRE(b[i] == static_cast<byte>(w >> 8));
+    REQUIRE(c[i] == static_cast<byte>(w));
+  }
+}
 
-    // test with mov instruction (requires 2 registers)
-    word w = (0x0c << 24) | (tc.value << 16) | (0x01 << 8); // mov rX, r1
-    auto result = codec::decode(w);
+TEST_CASE("SoA instruction stream") {
+  // to_soa splits a word stream into per-field arrays; check each array
+  // against the fields of the source instructions
+  static constexpr std::array<word, 10> words = {
+      0x00000000, // nop
+      0x21050000, // jmp r5
+      0x20123456, // jmi 0x123456
+      0x0b051234, // set r5 0x1234
+      0x0c050a00, // mov r5 r10
+      0x0d050a10, // ldw r5 r10 0x10
+      0x40051004, // sia r5 0x10 0x04
+      0x01050a0f, // add r5 r10 r15
+      0xf0abcdef, // int 0xabcdef
+      0xff000000, // hlt
+  };
+
+  instruction_soa soa;
+  to_soa(words.data(), words.size(), soa);
+  REQUIRE(soa.size() == words.size());
+
+  // spot checks per format
+  REQUIRE(soa.ops[0] == opcode::nop);
+  REQUIRE(soa.ops[1] == opcode::jmp);
+  REQUIRE(soa.a[1] == 0x05);
+  REQUIRE(soa.imm[2] == 0x123456);
+  REQUIRE(soa.a[3] == 0x05);
+  REQUIRE((soa.imm[3] & 0xffff) == 0x1234);
+  REQUIRE(soa.a[7] == 0x05);
+  REQUIRE(soa.b[7] == 0x0a);
+  REQUIRE(soa.c[7] == 0x0f);
+  REQUIRE(soa.imm[8] == 0xabcdef);
+  REQUIRE(soa.ops[9] == opcode::hlt);
+
+  // clear drops all field arrays together
+  soa.clear();
+  REQUIRE(soa.size() == 0);
+}
 
-    if (tc.valid) {
-      REQUIRE(result.is_ok());
+TEST_CASE("Register validation") {
+  // decode a mov with every possible register byte and collect the outcomes
+  // into a 256-bit mask, checked against the expected mask in one compare:
+  // ids 0x00-0x24 (r0-r31 plus pc/lr/ad/at/sp) are valid, everything above is not
+  std::array<uint64_t, 4> actual{};
+  for (uint32_t v = 0; v < 256; ++v) {
+    word w = (0x0c << 24) | (v << 16) | (0x01 << 8); // mov rX, r1
+    auto result = codec::decode(w);
+    if (result.is_ok()) {
+      actual[v / 64] |= uint64_t{1} << (v % 64);
     } else {
-      REQUIRE(result.is_err());
       REQUIRE(result.error() == decode_error::invalid_register);
     }
   }
+
+  constexpr std::array<uint64_t, 4> expected = {(uint64_t{1} << 37) - 1, 0, 0, 0};
+  REQUIRE(actual == expected);
 }
\ No newline at end of file
@@ -0,0 +1,172 @@
+#pragma once
+
+// shared helpers for IRRE tests
+
+#include "arch/encoding.hpp"
+#include "assembler/assembler.hpp"
+#include <array>
+#include <initializer_list>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__SSE4_2__)
+#include <cstring>
+#include <nmmintrin.h>
+#endif
+
+namespace irre::test {
+
+// single-needle substring check; on sse4.2 targets short needles scan the
+// haystack 16 bytes per pcmpestri instead of byte by byte
+inline bool contains_simd(std::string_view hay, std::string_view needle) {
+#if defined(__SSE4_2__)
+  if (!needle.empty() && needle.size() <= 16 && needle.size() <= hay.size()) {
+    char nbuf[16] = {};
+    std::memcpy(nbuf, needle.data(), needle.size());
+    const __m128i nv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nbuf));
+    const int nlen = static_cast<int>(needle.size());
+
+    size_t i = 0;
+    while (i < hay.size()) {
+      size_t rem = hay.size() - i;
+      __m128i hv;
+      int hlen;
+      if (rem >= 16) {
+        hv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay.data() + i));
+        hlen = 16;
+      } else {
+        // stage the tail through a buffer so the load never runs off the end
+        char hbuf[16] = {};
+        std::memcpy(hbuf, hay.data() + i, rem);
+        hv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hbuf));
+        hlen = static_cast<int>(rem);
+      }
+
+      // equal-ordered mode reports where a (possibly window-truncated) match
+      // of the needle begins; 16 means no match starts in this window
+      int idx = _mm_cmpestri(nv, nlen, hv, hlen, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ORDERED);
+      if (idx >= 16) {
+        i += 16;
+        continue;
+      }
+
+      // confirm candidates that may have been truncated by the window edge
+      size_t pos = i + static_cast<size_t>(idx);
+      if (pos + needle.size() <= hay.size() && std::memcmp(hay.data() + pos, needle.data(), needle.size()) == 0) {
+        return true;
+      }
+      i = pos + 1;
+    }
+    return false;
+  }
+#endif
+  return hay.find(needle) != std::string_view::npos;
+}
+
+// multi-needle substring search: an aho-corasick automaton over the needles
+// reports which ones occur in a single pass over the haystack, instead of one
+// linear scan per needle
+class multi_find {
+public:
+  multi_find(std::initializer_list<std::string_view> needles) {
+    nodes_.emplace_back();
+    uint64_t bit = 1;
+    for (auto needle : needles) {
+      uint32_t cur = 0;
+      for (unsigned char ch : needle) {
+        if (nodes_[cur].next[ch] == 0) {
+          nodes_[cur].next[ch] = static_cast<uint32_t>(nodes_.size());
+          nodes_.emplace_back();
+        }
+        cur = nodes_[cur].next[ch];
+      }
+      nodes_[cur].match |= bit;
+      all_ |= bit;
+      bit <<= 1;
+    }
+
+    // breadth-first pass turning the trie into a dense goto automaton: missing
+    // edges take the transition of the failure state, and match bits propagate
+    // along failure links so suffix matches are reported too
+    std::vector<uint32_t> queue;
+    for (uint32_t v : nodes_[0].next) {
+      if (v != 0) {
+        queue.push_back(v);
+      }
+    }
+    for (size_t qi = 0; qi < queue.size(); ++qi) {
+      uint32_t u = queue[qi];
+      nodes_[u].match |= nodes_[nodes_[u].fail].match;
+      for (size_t c = 0; c < 256; ++c) {
+        uint32_t v = nodes_[u].next[c];
+        if (v != 0) {
+          nodes_[v].fail = nodes_[nodes_[u].fail].next[c];
+          queue.push_back(v);
+        } else {
+          nodes_[u].next[c] = nodes_[nodes_[u].fail].next[c];
+        }
+      }
+    }
+  }
+
+  // bitmask of needles seen, in declaration order
+  uint64_t scan(std::string_view haystack) const {
+    uint64_t seen = 0;
+    uint32_t state = 0;
+    for (unsigned char ch : haystack) {
+      state = nodes_[state].next[ch];
+      seen |= nodes_[state].match;
+    }
+    return seen;
+  }
+
+  // true iff every needle occurs in the haystack
+  bool contains_all(std::string_view haystack) const { return scan(haystack) == all_; }
+
+private:
+  struct node {
+    std::array<uint32_t, 256> next{};
+    uint32_t fail = 0;
+    uint64_t match = 0;
+  };
+
+  std::vector<node> nodes_;
+  uint64_t all_ = 0;
+};
+
+// encode a fixed program straight from instruction constructors into a
+// compile-time byte array, so test programs are literals embedded in the
+// binary with no per-section vector assembly
+template <typename... insts> constexpr auto emit_program(const insts&... is) {
+  std::array<byte, sizeof...(insts) * 4> out{};
+  size_t pos = 0;
+  auto copy_one = [&](const std::array<byte, 4>& enc) {
+    for (byte b : enc) {
+      out[pos++] = b;
+    }
+  };
+  (copy_one(codec::encode_bytes(is)), ...);
+  return out;
+}
+
+// assemble with a process-wide cache keyed by source text. catch2 re-enters a
+// test case once per SECTION, so identical program literals would otherwise be
+// re-parsed and re-encoded on every pass; here the parser runs once per unique
+// program. the transparent comparator lets string_view callers (sources held
+// in .rodata) hit the cache without materializing a key string.
+inline const result<assembler::object_file, assembler::assembly_error>&
+cached_assemble(assembler::assembler& engine, std::string_view source) {
+  static std::map<std::string, result<assembler::object_file, assembler::assembly_error>, std::less<>> cache;
+  auto it = cache.find(source);
+  if (it == cache.end()) {
+    std::string key{source};
+    auto assembled = engine.assemble(key);
+    it = cache.emplace(std::move(key), std::move(assembled)).first;
+  }
+  return it->second;
+}
+
+} // namespace irre::test